@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+#include "../core/Button.hpp"
+#include "../core/ContainerFlex.hpp"
+#include "../core/ContainerGrid.hpp"
+#include "../core/ContainerList.hpp"
+#include "../core/ContainerListVirtual.hpp"
+#include "../core/Context.hpp"
+#include "../core/ScrollContainer.hpp"
+#include "../frontend/in/NullIn.hpp"
+#include "../frontend/out/NullOut.hpp"
+#include "../frontend/out/RasterOut.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "BENCH";
+
+
+/*
+ * ******************************************************** allocations
+ */
+
+static std::atomic<long> allocations { 0 };
+
+void* operator new(std::size_t size) {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	void *p = std::malloc(size == 0 ? 1 : size);
+	if (p == nullptr)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	std::free(p);
+}
+
+long benchAllocations() {
+	return allocations.load(std::memory_order_relaxed);
+}
+
+
+/*
+ * ******************************************************** layout
+ */
+
+static TraverseCondition onDraw(Component *c, void *userData) {
+	c->onDraw((const FrontendOut*) userData);
+	return TraverseCondition::notMatch;
+}
+
+// invalidates and lays out all children of a flat list, returns nodes per second
+static double benchLayout(Context &ctx, ContainerList &root, const NullOut &out, const int nodes,
+	    const int rounds) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < rounds; i++) {
+		root.invalidatePosition();
+		Component::traverseInclusive(&root, onDraw, (void*) &out);
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return (double) nodes * rounds / elapsed.count();
+}
+
+static void benchLayoutLevels(const int nodes, const int rounds) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerList root {&ctx};
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int i = 0; i < nodes; i++)
+		buttons.emplace_back(new Button(&root));
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+
+	ctx.setLogLevel(Context::LOG_DEBUG);
+	const double debug = benchLayout(ctx, root, out, nodes, rounds);
+	ctx.setLogLevel(Context::LOG_WARN);
+	const double warn = benchLayout(ctx, root, out, nodes, rounds);
+	std::printf("layout %7d nodes  debug %12.0f nodes/s  warn %12.0f nodes/s  (%ld draws, %ld log dropped)\n",
+	    nodes, debug, warn, out.getDrawCount(), ctx.getLogDropped());
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** loop
+ */
+
+struct LoopBench {
+	NullIn *in;
+	int frames;
+	int framesMax;
+};
+
+static const int loopExitEvent = 27;
+
+static int onLoopEvent(void *event, void *userData) {
+	return *(const int*) event == loopExitEvent ? 1 : 0;
+}
+
+static void onLoopRender(void *userData) {
+}
+
+// queues the exit event once enough frames were drawn
+static void onLoopDraw(void *userData) {
+	LoopBench *b = (LoopBench*) userData;
+	if (++b->frames == b->framesMax)
+		b->in->eventPush(loopExitEvent);
+}
+
+// whole frames through Context::gameLoop with an unreachable target fps, so that every
+// cycle draws
+static void benchLoop(const int nodes, const int frames) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerList root {&ctx};
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int i = 0; i < nodes; i++)
+		buttons.emplace_back(new Button(&root));
+	NullIn in {ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+
+	LoopBench b {&in, 0, frames};
+	const auto start = std::chrono::steady_clock::now();
+	ctx.gameLoop(1000 * 1000, false, onLoopEvent, onLoopRender, onLoopDraw, &b);
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::printf("loop   %7d nodes  %12.0f frames/s  %9.3f us/frame  (%ld draws, %lld bytes, %ld presents)\n",
+	    nodes, b.frames / elapsed.count(), elapsed.count() * 1e6 / b.frames, out.getDrawCount(),
+	    out.getByteCount(), out.getPresentCount());
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** raster
+ */
+
+// the font in res of the repository, found from the executable built in src or from the
+// working directory, empty if there is none
+static std::basic_string<char> rasterFontPath(const char *argv0) {
+	std::basic_string<char> dir = argv0 != nullptr ? argv0 : "";
+	const std::size_t slash = dir.rfind('/');
+	dir = slash == std::basic_string<char>::npos ? "." : dir.substr(0, slash);
+	const std::basic_string<char> paths[] { dir + "/../res/term14.pcf.gz", dir + "/res/term14.pcf.gz",
+	    "res/term14.pcf.gz", "../res/term14.pcf.gz" };
+	for (const auto &path : paths) {
+		std::FILE *f = std::fopen(path.c_str(), "rb");
+		if (f == nullptr)
+			continue;
+		std::fclose(f);
+		return path;
+	}
+	return "";
+}
+
+// whole frames into the software framebuffer with glyphs drawn
+static void benchRaster(const char *fontPath, const int nodes, const int frames) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerList root {&ctx};
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int i = 0; i < nodes; i++)
+		buttons.emplace_back(new Button(&root));
+	NullIn in {ctx};
+	RasterOut out {ctx, 1920, 1080, fontPath};
+
+	LoopBench b {&in, 0, frames};
+	const auto start = std::chrono::steady_clock::now();
+	ctx.gameLoop(1000 * 1000, false, onLoopEvent, onLoopRender, onLoopDraw, &b);
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::printf("raster %7d nodes  %12.0f frames/s  %9.3f us/frame\n", nodes, b.frames / elapsed.count(),
+	    elapsed.count() * 1e6 / b.frames);
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** virtual list
+ */
+
+struct VirtualBench {
+	LoopBench loop;
+	ContainerListVirtual *list;
+};
+
+static void onVirtualRow(Widget *w, const int row, void *userData) {
+	char buf[32];
+	std::snprintf(buf, sizeof(buf), "row %d", row);
+	w->setText(buf);
+}
+
+// scrolls by a few pixels every frame
+static void onVirtualDraw(void *userData) {
+	VirtualBench *b = (VirtualBench*) userData;
+	if (b->list != nullptr)
+		b->list->setScrollOffset(b->list->getScrollOffset() + 3);
+	onLoopDraw(&b->loop);
+}
+
+// a screen of materialized rows against a scrolling virtual list over the data set
+static void benchVirtual(const int rows, const int frames, const bool isVirtual) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	NullIn in {ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+	std::unique_ptr<ContainerList> list;
+	std::unique_ptr<ContainerListVirtual> virtualList;
+	std::vector<std::unique_ptr<Button>> buttons;
+	if (isVirtual) {
+		virtualList.reset(new ContainerListVirtual(&ctx));
+		virtualList->setRowCount(rows);
+		virtualList->setRowCallback(onVirtualRow, nullptr);
+	} else {
+		list.reset(new ContainerList(&ctx));
+		for (int i = 0; i < rows; i++)
+			buttons.emplace_back(new Button(list.get()));
+	}
+
+	VirtualBench b { {&in, 0, frames}, virtualList.get() };
+	const auto start = std::chrono::steady_clock::now();
+	ctx.gameLoop(1000 * 1000, false, onLoopEvent, onLoopRender, onVirtualDraw, &b);
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::printf("list   %7d rows   %-7s %12.0f frames/s  %9.3f us/frame  (%ld draws)\n", rows,
+	    isVirtual ? "virtual" : "plain", b.loop.frames / elapsed.count(),
+	    elapsed.count() * 1e6 / b.loop.frames, out.getDrawCount() / b.loop.frames);
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** scroll container
+ */
+
+struct ScrollBench {
+	LoopBench loop;
+	ScrollContainer *scroll;
+};
+
+// scrolls by a few pixels every frame
+static void onScrollDraw(void *userData) {
+	ScrollBench *b = (ScrollBench*) userData;
+	b->scroll->scrollBy(0, 3);
+	onLoopDraw(&b->loop);
+}
+
+// all rows exist, only those in view get laid out and drawn
+static void benchScroll(const int rows, const int frames) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	NullIn in {ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+	ScrollContainer scroll {&ctx};
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int i = 0; i < rows; i++)
+		buttons.emplace_back(new Button(&scroll));
+
+	ScrollBench b { {&in, 0, frames}, &scroll };
+	const auto start = std::chrono::steady_clock::now();
+	ctx.gameLoop(1000 * 1000, false, onLoopEvent, onLoopRender, onScrollDraw, &b);
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::printf("scroll %7d rows   %-7s %12.0f frames/s  %9.3f us/frame  (%ld draws)\n", rows,
+	    "rows", b.loop.frames / elapsed.count(), elapsed.count() * 1e6 / b.loop.frames,
+	    out.getDrawCount() / b.loop.frames);
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** grid
+ */
+
+// a dashboard of cells laid out again after a resize, all cells move
+static void benchGrid(const int side, const int rounds) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerGrid grid {&ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+	grid.setColumnCount(side);
+	grid.setRowCount(side);
+	grid.setColumnSize(0, 200);
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int i = 0; i < side * side; i++)
+		buttons.emplace_back(new Button(&grid));
+	grid.setCell(buttons[0].get(), 1, 1, side / 2, side / 2);
+	Component::layout(&grid);
+	const auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < rounds; r++) {
+		out.setScreenDimension({1920 - r % 2, 1080});
+		Component::layout(&grid);
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::printf("grid   %7d cells  %-7s %12.0f layouts/s %8.3f us/layout\n", side * side, "resize",
+	    rounds / elapsed.count(), elapsed.count() * 1e6 / rounds);
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** flex
+ */
+
+// a column of rows laid out again after a resize, a width change keeps the measures of
+// the cells, a font change measures everything again
+static void benchFlex(const int side, const int rounds, const bool isFont) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerFlex column {&ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+	column.setDirection(ContainerFlex::DIRECTION_COLUMN);
+	std::vector<std::unique_ptr<ContainerFlex>> rows;
+	std::vector<std::unique_ptr<Button>> buttons;
+	for (int r = 0; r < side; r++) {
+		rows.emplace_back(new ContainerFlex(&column));
+		column.setGrow(rows.back().get(), 1);
+		for (int c = 0; c < side; c++) {
+			buttons.emplace_back(new Button(rows.back().get()));
+			rows.back()->setGrow(buttons.back().get(), c % 3);
+		}
+	}
+	Component::layout(&column);
+	const std::pair<long,long> measures = ctx.getMeasureStat();
+	const auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < rounds; r++) {
+		if (isFont)
+			out.setFontDimension({8, 16 + r % 2});
+		else
+			out.setScreenDimension({1920 - r % 200, 1080});
+		Component::layout(&column);
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const std::pair<long,long> m = ctx.getMeasureStat();
+	std::printf("flex   %7d cells  %-7s %12.0f layouts/s %8.3f us/layout  (%ld hits %ld misses)\n",
+	    side * side, isFont ? "font" : "resize", rounds / elapsed.count(), elapsed.count() * 1e6 / rounds,
+	    (m.first - measures.first) / rounds, (m.second - measures.second) / rounds);
+	// children before their parents, the unique_ptrs would go the other way round
+	for (auto b = buttons.rbegin(); b != buttons.rend(); b++)
+		b->reset();
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** churn
+ */
+
+// rows created, laid out and destroyed again, from the context pools or with new
+static void benchChurn(const int rows, const int rounds, const bool isPooled) {
+	Context ctx;
+	ctx.setLogLevel(Context::LOG_WARN);
+	ContainerList root {&ctx};
+	NullOut out {ctx, {1920, 1080}, {8, 16}};
+	ContainerList *list = ctx.create<ContainerList>(&root);
+	std::vector<Button*> buttons;
+	const long allocs = benchAllocations();
+	const auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < rows; i++)
+			buttons.push_back(isPooled ? ctx.create<Button>(list) : new Button(list));
+		Component::layout(&root);
+		// from the back, a removal moves all later siblings
+		for (auto b = buttons.rbegin(); b != buttons.rend(); b++)
+			Component::destroy(*b);
+		buttons.clear();
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const double n = (double) rows * rounds;
+	std::printf("churn  %7d rows   %-6s %12.0f rows/s  %6.3f allocs/row  (%d slabs)\n", rows,
+	    isPooled ? "pool" : "new", n / elapsed.count(), (benchAllocations() - allocs) / n,
+	    ctx.getPoolStat().second);
+	Component::destroy(list);
+	ctx.logFlush();
+}
+
+
+/*
+ * ******************************************************** main
+ */
+
+// swfbench [rounds] [max tree nodes] [seconds budget per tree size]
+int main(int argc, char **argv) {
+	const int rounds = argc > 1 ? std::atoi(argv[1]) : 20;
+	const int nodesMax = argc > 2 ? std::atoi(argv[2]) : 1000 * 1000;
+	const double budget = argc > 3 ? std::atof(argv[3]) : 10;
+	std::printf("SWF_LOG_LEVEL_MIN %d, %d rounds\n", SWF_LOG_LEVEL_MIN, rounds);
+	for (int nodes = 1000; nodes <= 100000; nodes *= 10)
+		benchLayoutLevels(nodes, rounds);
+	for (int nodes = 10; nodes <= 10000; nodes *= 10)
+		benchLoop(nodes, rounds * 50);
+	const std::basic_string<char> fontPath = rasterFontPath(argv[0]);
+	if (fontPath.empty())
+		std::fprintf(stderr, "raster skipped, res/term14.pcf.gz not found from %s\n", argv[0]);
+	else
+		for (int nodes = 10; nodes <= 1000; nodes *= 10)
+			benchRaster(fontPath.c_str(), nodes, rounds * 5);
+	benchVirtual(68, rounds * 50, false);
+	for (int rows = 1000; rows <= 1000 * 1000; rows *= 10)
+		benchVirtual(rows, rounds * 50, true);
+	for (int rows = 1000; rows <= 100 * 1000; rows *= 10)
+		benchScroll(rows, rounds * 50);
+	for (int side = 10; side <= 100; side *= 10)
+		benchGrid(side, rounds * 50);
+	for (int side = 10; side <= 100; side *= 10) {
+		benchFlex(side, rounds * 50, false);
+		benchFlex(side, rounds * 50, true);
+	}
+	for (int rows = 100; rows <= 10000; rows *= 10) {
+		benchChurn(rows, rounds * 10, false);
+		benchChurn(rows, rounds * 10, true);
+	}
+	benchTree(nodesMax, budget);
+	return 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "Bench.hpp"
+
+#include "../core/Button.hpp"
+#include "../core/ComponentStore.hpp"
+#include "../core/ContainerList.hpp"
+#include "../core/SpatialIndex.hpp"
+#include "../core/Context.hpp"
+#include "../frontend/in/NullIn.hpp"
+#include "../frontend/out/NullOut.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "BENCH_TREE";
+
+// layout recurses, so deep shapes are built from chains of bounded depth
+static const int chainDepthMax = 1000;
+
+
+/*
+ * ******************************************************** tree
+ */
+
+// expose the protected layout entry points to the benchmark
+class TreeList : public ContainerList {
+
+public:
+	TreeList(Context *ctx) : ContainerList(ctx) {
+	}
+
+	TreeList(Container *c) : ContainerList(c) {
+	}
+
+	const Position* position() {
+		return getPosition();
+	}
+
+};
+
+class TreeButton : public Button {
+
+public:
+	TreeButton(Container *c) : Button(c) {
+	}
+
+	const Position* position() {
+		return getPosition();
+	}
+
+};
+
+struct Tree {
+	Context ctx;
+	std::unique_ptr<TreeList> root;
+	std::vector<std::unique_ptr<TreeList>> lists;
+	std::vector<std::unique_ptr<TreeButton>> buttons;
+	std::unique_ptr<NullIn> in;
+	std::unique_ptr<NullOut> out;
+	int nodes;
+};
+
+// wide: all components are children of the root
+static void treeBuildWide(Tree &t, const int nodes) {
+	for (int i = 1; i < nodes; i++)
+		t.buttons.emplace_back(new TreeButton(t.root.get()));
+}
+
+// deep: chains below the root, every level is a list holding the next level and a button
+static void treeBuildDeep(Tree &t, const int nodes) {
+	Container *parent = t.root.get();
+	int depth = 0;
+	for (int i = 1; i < nodes; i += 2) {
+		if (depth == chainDepthMax) {
+			parent = t.root.get();
+			depth = 0;
+		}
+		t.lists.emplace_back(new TreeList(parent));
+		parent = t.lists.back().get();
+		t.buttons.emplace_back(new TreeButton(parent));
+		depth++;
+	}
+}
+
+
+/*
+ * ******************************************************** measurements
+ */
+
+struct Measure {
+	const char *name;
+	double nanosPerNode;
+	double allocsPerNode;
+};
+
+template<typename F>
+static Measure measure(const char *name, const Tree &t, const int rounds, F f) {
+	const long allocs = benchAllocations();
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < rounds; i++)
+		f();
+	const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	const double n = (double) t.nodes * rounds;
+	return { name, elapsed.count() / n, (benchAllocations() - allocs) / n };
+}
+
+static TraverseCondition onNoop(Component *c, void *userData) {
+	(*(long*) userData)++;
+	return TraverseCondition::notMatch;
+}
+
+// every 16th component matches
+static TraverseCondition onMatch(Component *c, void *userData) {
+	return ((*(long*) userData)++ & 15) == 0 ? TraverseCondition::match : TraverseCondition::notMatch;
+}
+
+struct Frame {
+	NullIn *in;
+	int frames;
+};
+
+static int onFrameEvent(void *event, void *userData) {
+	return 1;
+}
+
+static void onFrameRender(void *userData) {
+}
+
+static void onFrameDraw(void *userData) {
+	Frame *f = (Frame*) userData;
+	f->frames++;
+	f->in->eventPush(0);
+}
+
+// one frame through the loop draws all components once
+static void treeFrame(Tree &t) {
+	Frame f { t.in.get(), 0 };
+	t.ctx.gameLoop(1000 * 1000, false, onFrameEvent, onFrameRender, onFrameDraw, &f);
+}
+
+static std::vector<Measure> treeMeasure(Tree &t, const int rounds) {
+	std::vector<Measure> ms;
+	long count = 0;
+	ms.push_back(measure("layout cold", t, rounds, [&t] {
+		t.root->invalidatePosition();
+		for (auto &l : t.lists)
+			l->position();
+		for (auto &b : t.buttons)
+			b->position();
+	}));
+	// marking stops at an already dirty tree, so the invalidation is only measured
+	// together with the layout that cleans the tree again
+	ms.push_back(measure("layout pass", t, rounds, [&t] {
+		t.root->invalidatePosition();
+		Component::layout(t.root.get());
+	}));
+	ms.push_back(measure("layout warm", t, rounds, [&t] {
+		for (auto &l : t.lists)
+			l->position();
+		for (auto &b : t.buttons)
+			b->position();
+	}));
+	ms.push_back(measure("relayout leaf", t, rounds, [&t] {
+		t.buttons.back()->invalidateSize();
+		Component::layout(t.root.get());
+	}));
+	ms.push_back(measure("trav incl", t, rounds, [&t, &count] {
+		Component::traverseInclusive(t.root.get(), onNoop, &count);
+	}));
+	ms.push_back(measure("trav excl", t, rounds, [&t, &count] {
+		Component::traverseExclusive(t.root.get(), onNoop, &count);
+	}));
+	ms.push_back(measure("visit incl", t, rounds, [&t, &count] {
+		Component::visitInclusive(t.root.get(), [&count](Component *c) {
+			count++;
+			return TraverseCondition::notMatch;
+		});
+	}));
+	ms.push_back(measure("visit post", t, rounds, [&t, &count] {
+		Component::visitInclusive(t.root.get(), [&count](Component *c) {
+			count++;
+			return TraverseCondition::notMatch;
+		}, TraverseOrder::post);
+	}));
+	ms.push_back(measure("range find", t, rounds, [&t, &count] {
+		for (Component *c : Component::subtree(t.root.get()))
+			if ((count++ & 15) == 0)
+				c->getContext();
+	}));
+	ms.push_back(measure("find incl", t, rounds, [&t, &count] {
+		Component::findComponentsInclusive(t.root.get(), onMatch, &count);
+	}));
+	ms.push_back(measure("draw", t, rounds, [&t] {
+		treeFrame(t);
+	}));
+	ComponentStore store;
+	ms.push_back(measure("store build", t, rounds, [&t, &store] {
+		store.build(t.root.get());
+	}));
+	ms.push_back(measure("store draw", t, rounds, [&t, &store] {
+		store.draw(t.out.get());
+	}));
+	ms.push_back(measure("store find", t, rounds, [&store, &count] {
+		count += store.find(0, 0);
+	}));
+	SpatialIndex index;
+	const std::pair<int,int> screen = t.out->screenDimension();
+	ms.push_back(measure("hit build", t, rounds, [&t, &index, &screen] {
+		index.build(t.root.get(), screen);
+	}));
+	// one point query per node on a diagonal walk over the screen
+	ms.push_back(measure("hit find", t, rounds, [&t, &index, &screen, &count] {
+		for (int i = 0; i < t.nodes; i++)
+			count += index.find(i * 7 % screen.first, i * 13 % screen.second) != nullptr;
+	}));
+	return ms;
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// a shape stops growing when the next size would exceed the budget in seconds even at
+// linear cost, quadratic behaviour shows as the early stop
+void benchTree(const int nodesMax, const double budget) {
+	const char *shapes[] { "wide", "deep" };
+	for (int shape = 0; shape < 2; shape++) {
+		for (int nodes = 1000; nodes <= nodesMax; nodes *= 10) {
+			const auto start = std::chrono::steady_clock::now();
+			Tree t;
+			t.ctx.setLogLevel(Context::LOG_WARN);
+			t.nodes = nodes;
+			const long allocs = benchAllocations();
+			t.root.reset(new TreeList(&t.ctx));
+			if (shape == 0)
+				treeBuildWide(t, nodes);
+			else
+				treeBuildDeep(t, nodes);
+			t.in.reset(new NullIn(t.ctx));
+			t.out.reset(new NullOut(t.ctx, {1920, 1080}, {8, 16}));
+			std::printf("tree %s %7d nodes  build %.1f allocs/node\n", shapes[shape], nodes,
+			    (double) (benchAllocations() - allocs) / nodes);
+			const int rounds = nodes >= 100000 ? 1 : 100000 / nodes;
+			for (const Measure &m : treeMeasure(t, rounds))
+				std::printf("  %-14s %10.1f ns/node %8.3f allocs/node\n", m.name, m.nanosPerNode,
+				    m.allocsPerNode);
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			if (elapsed.count() * 10 > budget && nodes < nodesMax) {
+				std::printf("tree %s stops at %d nodes, took %.1fs\n", shapes[shape], nodes,
+				    elapsed.count());
+				break;
+			}
+		}
+	}
+}
@@ -36,7 +36,7 @@ Button::Button(Container *c) : Widget(c) {
 }
 
 Button::~Button() {
-	SWFLOG(getContext(), LOG_WARN, nullptr);
+	SWFLOG(getContext(), LOG_DEBUG, nullptr);
 }
 
 
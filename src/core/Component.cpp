@@ -17,16 +17,23 @@
 #include "Component.hpp"
 
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 #include "Container.hpp"
 #include "Context.hpp"
 #include "FrontendOut.hpp"
+#include "Pool.hpp"
+#include "Profile.hpp"
+#include "ViewportOut.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "COMPONENT";
 
+// childDirty when no child is dirty
+static const int childDirtyNone = std::numeric_limits<int>::max();
+
 
 /*
  * ******************************************************** constructor / destructor
@@ -40,8 +47,16 @@ Component::Component(Context* ctx) {
 	}
 	parent = nullptr;
 	context = ctx;
+	pool = nullptr;
+	contentsIndex = 0;
+	dirty = DIRTY_POSITION | DIRTY_SIZE | DIRTY_CHILD | DIRTY_MEASURE;
+	childDirty = childDirtyNone;
+	measureConstraint[0] = {-1, -1};
+	measureConstraint[1] = {-1, -1};
+	measureSize[0] = {0, 0};
+	measureSize[1] = {0, 0};
+	measureEpoch = 0;
 	style = {0, 0};
-	onInvalidatePosition(this, nullptr);
 	context->setRootContainer((Container*) this);
 }
 
@@ -53,9 +68,21 @@ Component::Component(Container* p) {
 	}
 	context = nullptr;
 	parent = p;
+	pool = nullptr;
+	contentsIndex = 0;
+	dirty = DIRTY_POSITION | DIRTY_SIZE | DIRTY_CHILD | DIRTY_MEASURE;
+	childDirty = childDirtyNone;
+	measureConstraint[0] = {-1, -1};
+	measureConstraint[1] = {-1, -1};
+	measureSize[0] = {0, 0};
+	measureSize[1] = {0, 0};
+	measureEpoch = 0;
 	style = {0, 0};
-	onInvalidatePosition(this, nullptr);
 	((Component*) parent)->addToContents(this);
+	markAncestors(this);
+}
+
+Component::~Component() {
 }
 
 
@@ -63,21 +90,36 @@ Component::Component(Container* p) {
  * ******************************************************** private
  */
 
-TraverseCondition Component::onInvalidatePosition(Component *c, void *ud) {
-	c->position.x = -1;
-	return TraverseCondition::notMatch;
+// destructs the component and returns its memory to where it came from
+void Component::release(Component *c) {
+	Pool *p = c->pool;
+	if (p == nullptr) {
+		delete c;
+		return;
+	}
+	c->~Component();
+	p->release(c);
+}
+
+// flags the path to the root, so that layout finds the dirty component, every parent
+// starts its layout at or before the child on the path
+void Component::markAncestors(Component *c) {
+	for (Component *p = (Component*) c->parent; p != nullptr; c = p, p = (Component*) p->parent) {
+		p->childDirty = std::min(p->childDirty, c->contentsIndex);
+		if (p->dirty & DIRTY_CHILD)
+			return;
+		p->dirty |= DIRTY_CHILD;
+	}
 }
 
 inline bool Component::isPositionValid() const {
-	return position.x != -1;
+	return !(dirty & (DIRTY_POSITION | DIRTY_SIZE));
 }
 
-// returns position index of component in parent container
+// returns position index of component in parent container, maintained by the container
+// on every change of its contents, so layout does not search the siblings
 int Component::positionIndex() const {
-	if (parent == nullptr)
-		return 0;
-	const auto contents = parent->contents();
-	return std::distance(contents->begin(), std::find(contents->begin(), contents->end(), this));
+	return contentsIndex;
 }
 
 
@@ -95,6 +137,72 @@ const Container* Component::getParent() const {
 	return parent;
 }
 
+bool Component::isPositionDirty(const Component *c) {
+	return !c->isPositionValid();
+}
+
+// the children before are clean, layoutChildren sweeps need not look at them
+int Component::firstDirtyChild() {
+	return std::min(childDirty, (int) contents()->size());
+}
+
+// places a component at the rect computed by a layoutChildren sweep of its parent
+void Component::setPosition(Component *c, const Position &p) {
+	c->position = p;
+	c->applyStyle();
+	c->dirty &= ~(DIRTY_POSITION | DIRTY_SIZE);
+}
+
+// the extent left inside margin and padding, unbounded stays unbounded
+int Component::innerExtent(const int extent, const int space) {
+	return extent == extentUnbounded ? extentUnbounded : std::max(extent - 2 * space, 0);
+}
+
+int Component::getPositionIndex(const Component *c) {
+	return c->contentsIndex;
+}
+
+// containers call this for every component whose place in the contents changed
+void Component::setPositionIndex(Component *c, const int index) {
+	c->contentsIndex = index;
+}
+
+// shrinks the rect given by the parent by margin and padding
+void Component::applyStyle() {
+	position.w = position.w - 2 * style.margin;
+	if (position.w < 1)
+		position.w = 1;
+	position.h = position.h - 2 * style.margin;
+	if (position.h < 1)
+		position.h = 1;
+	if (position.w > 2 * (style.margin + style.padding)) {
+		position.x = position.x + style.margin;
+		position.textX = position.x + style.padding;
+	} else {
+		position.textX = position.x;
+	}
+	if (position.h > 2 * (style.margin + style.padding)) {
+		position.y = position.y + style.margin;
+		position.textY = position.y + style.padding;
+	} else {
+		position.textY = position.y;
+	}
+}
+
+// marks the component and its descendants, stops at already dirty subtrees, returns the
+// number of newly marked components
+int Component::markPositionDirty(Component *c) {
+	if (c->dirty & DIRTY_POSITION)
+		return 0;
+	c->dirty |= DIRTY_POSITION | DIRTY_CHILD;
+	if (c->parent != nullptr)
+		((Component*) c->parent)->childDirty = std::min(((Component*) c->parent)->childDirty, c->contentsIndex);
+	int count = 1;
+	for (auto child : *c->contents())
+		count += markPositionDirty(child);
+	return count;
+}
+
 Context* Component::getContext() {
 	if (context != nullptr)
 		return context;
@@ -111,6 +219,7 @@ Context* Component::getContext() {
 }
 
 const Position* Component::getPosition() {
+	SWF_ZONE("Component::getPosition");
 	if (isPositionValid())
 		return &position;
 	const FrontendOut *out = getContext()->getFrontendOut();
@@ -118,6 +227,8 @@ const Position* Component::getPosition() {
 		SWFLOG(getContext(), LOG_WARN, "no frontendOut");
 		return nullptr;
 	}
+	dirty &= ~(DIRTY_POSITION | DIRTY_SIZE);
+	getContext()->layoutCount(1, 0);
 	if (parent == nullptr) {
 		position.x = 0;
 		position.y = 0;
@@ -128,24 +239,7 @@ const Position* Component::getPosition() {
 		return &position;
 	}
 	parent->calculatePosition(positionIndex(), style, &position);
-	position.w = position.w - 2 * style.margin;
-	if (position.w < 1)
-		position.w = 1;
-	position.h = position.h - 2 * style.margin;
-	if (position.h < 1)
-		position.h = 1;
-	if (position.w > 2 * (style.margin + style.padding)) {
-		position.x = position.x + style.margin;
-		position.textX = position.x + style.padding;
-	} else {
-		position.textX = position.x;
-	}
-	if (position.h > 2 * (style.margin + style.padding)) {
-		position.y = position.y + style.margin;
-		position.textY = position.y + style.padding;
-	} else {
-		position.textY = position.y;
-	}
+	applyStyle();
 	SWFLOG(getContext(), LOG_DEBUG, "%d+%d %dx%d t%d+%d m%d p%d", position.x, position.y,
 	    position.w, position.h, position.textX, position.textY, style.margin, style.padding);
 	return &position;
@@ -155,6 +249,49 @@ const Style* Component::getStyle() const {
 	return &style;
 }
 
+const Style* Component::getStyle(const Component *c) {
+	return &c->style;
+}
+
+// text drawn into the component
+const std::basic_string<char>& Component::getText() const {
+	static const std::basic_string<char> text = "blaau";
+	return text;
+}
+
+// returns true when the click is handled, otherwise it goes on to the parent
+bool Component::onClick(const int x, const int y) {
+	return false;
+}
+
+// plain components draw and hit their contents at the laid out positions
+const Viewport* Component::getViewport() {
+	return nullptr;
+}
+
+// components without contents have no children to place
+int Component::layoutChildren() {
+	return 0;
+}
+
+// one line of text with margin and padding around
+Size Component::onMeasure(const Constraint &constraint) {
+	const FrontendOut *out = getContext()->getFrontendOut();
+	if (out == nullptr)
+		return {0, 0};
+	const std::pair<int,int> font = out->fontDimension();
+	const int space = style.margin + style.padding;
+	return { std::min((int) getText().size() * font.first + 2 * space, constraint.w),
+	    std::min(font.second + 2 * space, constraint.h) };
+}
+
+// nobody measured the component since its last change, so no layout depends on its size
+void Component::invalidateContent() {
+	if (dirty & DIRTY_MEASURE)
+		return;
+	invalidateSize();
+}
+
 
 /*
  * ******************************************************** public
@@ -169,9 +306,131 @@ bool Component::isStateFocus() const {
 	return false;
 }
 
+// offers the click to the component and its ancestors until one handles it
+bool Component::eventClick(const int x, const int y) {
+	for (Component *c = this; c != nullptr; c = (Component*) c->parent)
+		if (c->onClick(x, y))
+			return true;
+	return false;
+}
+
+// removes the component from its parent, later siblings move up
+void Component::detach() {
+	if (parent == nullptr) {
+		SWFLOG(getContext(), LOG_WARN, "not attached");
+		return;
+	}
+	Context *ctx = getContext();	// keeps the context cached while detached
+	((Component*) parent)->removeFromContents(this);
+	parent = nullptr;
+	markPositionDirty(this);
+	ctx->contentsChanged();
+}
+
+// appends a detached component to the contents of the container
+void Component::reattach(Container *p) {
+	if (p == nullptr || ((Component*) p)->getContext() != getContext()) {
+		SWFLOG(getContext(), LOG_WARN, "cannot attach to another context");
+		return;
+	}
+	if (parent != nullptr)
+		detach();
+	parent = p;
+	((Component*) parent)->addToContents(this);
+	getContext()->layoutCount(0, markPositionDirty(this));
+	markAncestors(this);
+	getContext()->contentsChanged();
+}
+
+// detaches the component and releases it with all descendants, children first
+void Component::destroy(Component *c) {
+	if (c->parent != nullptr)
+		c->detach();
+	if (c == (Component*) c->getContext()->getRootContainer())
+		c->getContext()->setRootContainer(nullptr);
+	for (Component *current = firstPostOrder(c); current != nullptr; ) {
+		Component *next = nextPostOrder(current, c);
+		// the children are released already, a destructor sees no contents, leaves
+		// share one static empty vector that is only read
+		std::vector<Component*> *cs = current->contents();
+		if (!cs->empty())
+			cs->clear();
+		release(current);
+		current = next;
+	}
+}
+
 void Component::invalidatePosition() {
 	SWFLOG(getContext(), LOG_DEBUG, nullptr);
-	traverseInclusive(this, onInvalidatePosition, nullptr);
+	getContext()->layoutCount(0, markPositionDirty(this));
+	markAncestors(this);
+}
+
+void Component::invalidateSize() {
+	SWFLOG(getContext(), LOG_DEBUG, nullptr);
+	// a parent with a measured size may be sized by the component and resizes as well
+	for (Component *c = this; c != nullptr; c = (Component*) c->parent) {
+		c->dirty |= DIRTY_SIZE | DIRTY_MEASURE;
+		getContext()->layoutCount(0, markPositionDirty(c));
+		markAncestors(c);
+		if (c->parent == nullptr)
+			return;
+		c->parent->onContentsResized(c);
+		if (((Component*) c->parent)->dirty & DIRTY_MEASURE)
+			return;
+	}
+}
+
+// the size the component wants within the constraint, cached until the content, the
+// constraint or the font changes
+Size Component::measure(Component *c, const Constraint &constraint) {
+	Context *ctx = c->getContext();
+	if ((c->dirty & DIRTY_MEASURE) || c->measureEpoch != ctx->getMeasureEpoch()) {
+		c->measureConstraint[0] = {-1, -1};
+		c->measureConstraint[1] = {-1, -1};
+		c->measureEpoch = ctx->getMeasureEpoch();
+		c->dirty &= ~DIRTY_MEASURE;
+	}
+	for (int i = 0; i < 2; i++) {
+		if (c->measureConstraint[i].w == constraint.w && c->measureConstraint[i].h == constraint.h) {
+			ctx->measureCount(true);
+			return c->measureSize[i];
+		}
+	}
+	ctx->measureCount(false);
+	const Size s = c->onMeasure(constraint);
+	c->measureConstraint[1] = c->measureConstraint[0];
+	c->measureSize[1] = c->measureSize[0];
+	c->measureConstraint[0] = constraint;
+	c->measureSize[0] = s;
+	return s;
+}
+
+// recomputes the dirty components below c, visits only subtrees flagged dirty
+int Component::layout(Component *c) {
+	SWF_ZONE("Component::layout");
+	int count = 0;
+	if (!c->isPositionValid()) {
+		c->getPosition();
+		count++;
+	}
+	if (c->dirty & DIRTY_CHILD) {
+		c->dirty &= ~DIRTY_CHILD;
+		count += c->layoutChildren();
+		// children outside a viewport stay dirty until scrolled into view
+		const std::vector<Component*> &cs = *c->contents();
+		const Viewport *v = c->getViewport();
+		const int first = std::max(v == nullptr ? 0 : v->first, c->childDirty);
+		const int last = v == nullptr ? cs.size() : v->last;
+		for (int i = first; i < last; i++)
+			if (cs[i]->dirty & DIRTY_CHILD)
+				count += layout(cs[i]);
+		// children marked during the sweep flagged the component again and keep the index
+		if (!(c->dirty & DIRTY_CHILD) && (v == nullptr || c->childDirty >= v->first))
+			c->childDirty = v == nullptr || v->last >= (int) cs.size() ? childDirtyNone :
+			    std::max(c->childDirty, v->last);
+	}
+	return count;
 }
 
 void Component::onDraw(const FrontendOut *out) {
@@ -180,7 +439,25 @@ void Component::onDraw(const FrontendOut *out) {
 		return;
 	const Position *p = getPosition();
 	const Style *s = getStyle();
-	out->draw(*p, *s, "blaau");
+	out->draw(*p, *s, getText());
+}
+
+
+// draws the subtree in pre order, the visible children of a viewport are drawn shifted
+// and clipped, the others are culled
+void Component::draw(Component *c, const FrontendOut *out) {
+	SWF_ZONE("Component::draw");
+	visitInclusive(c, [out](Component *current) {
+		current->onDraw(out);
+		const Viewport *v = current->getViewport();
+		if (v == nullptr)
+			return TraverseCondition::notMatch;
+		const ViewportOut viewportOut {*out, *v};
+		const std::vector<Component*> &cs = *current->contents();
+		for (int i = v->first; i < v->last; i++)
+			draw(cs[i], &viewportOut);
+		return TraverseCondition::notMatchSkip;
+	});
 }
 
 
@@ -188,36 +465,62 @@ void Component::onDraw(const FrontendOut *out) {
  * component traversing
  */
 
-bool Component::traverseExclusive(Component *c, TraverseCondition (*cb)(Component*, void*), void *userData, std::vector<Component*> *matches) {
-	bool running;
-	for (auto current : *c->contents()) {
-		switch (cb(current, userData)) {
-		case TraverseCondition::match:
-			if (matches == nullptr)
-				SWFLOG(c->context, LOG_WARN, "cannot add match");
-			else
-				matches->push_back(current);
-			running = traverseExclusive(current, cb, userData, matches);
-			if (!running)
-				return false;
-			break; // not reached
-		case TraverseCondition::matchBreak:
-			if (matches == nullptr)
-				SWFLOG(c->context, LOG_WARN, "cannot add match");
-			else
-				matches->push_back(current);
-			return false;
-			break; // not reached
-		case TraverseCondition::notMatch:
-			running = traverseExclusive(current, cb, userData, matches);
-			if (!running)
-				return false;
-			break;
-		case TraverseCondition::notMatchBreak:
-			return false;
-		}
+// pre order successor below root, children first, then the next sibling of the
+// component or of its nearest ancestor
+Component* Component::nextPreOrder(Component *c, const Component *root) {
+	const std::vector<Component*> *cs = c->contents();
+	if (!cs->empty())
+		return cs->front();
+	return nextPreOrderSkip(c, root);
+}
+
+// pre order successor passing over the children
+Component* Component::nextPreOrderSkip(Component *c, const Component *root) {
+	while (c != root) {
+		Component *p = (Component*) c->parent;
+		const std::vector<Component*> *siblings = p->contents();
+		const std::size_t next = c->contentsIndex + 1;
+		if (next < siblings->size())
+			return (*siblings)[next];
+		c = p;
 	}
-	return true;
+	return nullptr;
+}
+
+// leftmost leaf, the first component in post order
+Component* Component::firstPostOrder(Component *c) {
+	for (const std::vector<Component*> *cs = c->contents(); !cs->empty(); cs = c->contents())
+		c = cs->front();
+	return c;
+}
+
+// post order successor below root, the leftmost leaf of the next sibling or the parent
+Component* Component::nextPostOrder(Component *c, const Component *root) {
+	if (c == root)
+		return nullptr;
+	Component *p = (Component*) c->parent;
+	const std::vector<Component*> *siblings = p->contents();
+	const std::size_t next = c->contentsIndex + 1;
+	if (next < siblings->size())
+		return firstPostOrder((*siblings)[next]);
+	return p;
+}
+
+static TraverseCondition collectMatch(Component *c, const TraverseCondition condition, std::vector<Component*> *matches) {
+	if (condition != TraverseCondition::match && condition != TraverseCondition::matchBreak)
+		return condition;
+	if (matches == nullptr)
+		SWFLOG(c->getContext(), LOG_WARN, "cannot add match");
+	else
+		matches->push_back(c);
+	return condition;
+}
+
+bool Component::traverseExclusive(Component *c, TraverseCondition (*cb)(Component*, void*), void *userData, std::vector<Component*> *matches) {
+	SWF_ZONE("Component::traverseExclusive");
+	return visitExclusive(c, [cb, userData, matches](Component *current) {
+		return collectMatch(current, cb(current, userData), matches);
+	});
 }
 
 bool Component::traverseExclusive(Component *c, TraverseCondition (*cb)(Component*, void*), void *userData) {
@@ -225,27 +528,10 @@ bool Component::traverseExclusive(Component *c, TraverseCondition (*cb)(Componen
 }
 
 bool Component::traverseInclusive(Component *c, TraverseCondition (*cb)(Component*, void*), void *userData, std::vector<Component*> *matches) {
-	switch (cb(c, userData)) {
-	case TraverseCondition::match:
-		if (matches == nullptr)
-			SWFLOG(c->context, LOG_WARN, "cannot add match");
-		else
-			matches->push_back(c);
-		break;
-	case TraverseCondition::matchBreak:
-		if (matches == nullptr)
-			SWFLOG(c->context, LOG_WARN, "cannot add match");
-		else
-			matches->push_back(c);
-		return false;
-		break; // not reached
-	case TraverseCondition::notMatch:
-		break;
-	case TraverseCondition::notMatchBreak:
-		return false;
-		break; // not reached
-	}
-	return traverseExclusive(c, cb, userData, matches);
+	SWF_ZONE("Component::traverseInclusive");
+	return visitInclusive(c, [cb, userData, matches](Component *current) {
+		return collectMatch(current, cb(current, userData), matches);
+	});
 }
 
 bool Component::traverseInclusive(Component *c, TraverseCondition (*cb)(Component*, void*), void *userData) {
@@ -17,12 +17,15 @@
 #ifndef SWF_CORE_COMPONENT
 #define SWF_CORE_COMPONENT
 
+#include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
 class Container;
 class Context;
 class FrontendOut;
+class Pool;
 
 struct Position {
 	int x, y, w, h, textX, textY;
@@ -32,43 +35,115 @@ struct Style {
 	int margin, padding;
 };
 
+struct Size {
+	int w, h;
+};
+
+// the largest size a component may take when measured, the key of its measure cache
+struct Constraint {
+	int w, h;
+};
+
+static const int extentUnbounded = std::numeric_limits<int>::max();
+
+// contents shown through a viewport are shifted by the offset and clipped to the clip
+// rect, only the children in [first, last) can be visible
+struct Viewport {
+	Position clip;
+	int offsetX, offsetY;
+	int first, last;
+};
+
 //enum TraverseCondition { continueTraverse, returnCurrent, skipChildren };
-enum class TraverseCondition { match, matchBreak, notMatch, notMatchBreak };
+enum class TraverseCondition { match, matchBreak, notMatch, notMatchBreak, notMatchSkip };
+enum class TraverseOrder { pre, post };
 
 class Component {
 
+	friend class ComponentStore;
+	friend class Context;
+	friend class SpatialIndex;
+
 private:
 	Container *parent;
 	Context *context; // cache to context
+	Pool *pool;	// slab of the context the component lives in, nullptr when created with new
 
 	// position
 	Position position;
-	static TraverseCondition onInvalidatePosition(Component*, void*);
+	int contentsIndex;	// index in the contents of the parent, kept by the parent
+	unsigned char dirty;	// DIRTY_ flags, a dirty component has only dirty descendants
+	int childDirty;		// no child below this index is dirty, layout starts here
+
+	// measure cache of the last two constraints, a container measuring and arranging
+	// its children asks with two, valid until the content changes
+	Constraint measureConstraint[2];
+	Size measureSize[2];
+	int measureEpoch;
 	inline bool isPositionValid() const;
+	void applyStyle();
 	int positionIndex() const;
 
 	virtual void addToContents(Component*) = 0;
+	virtual void removeFromContents(Component*) = 0;
+	static void release(Component*);
+
+	// stackless walk along the parent and the contents index, nullptr past the root
+	static Component* nextPreOrder(Component*, const Component*);
+	static Component* nextPreOrderSkip(Component*, const Component*);
+	static Component* firstPostOrder(Component*);
+	static Component* nextPostOrder(Component*, const Component*);
+	static bool isBreak(const TraverseCondition);
 
 protected:
 	Style style;
 
+	enum DirtyFlag { DIRTY_POSITION = 1, DIRTY_SIZE = 2, DIRTY_CHILD = 4, DIRTY_MEASURE = 8 };
+
 	inline const Container* getParent() const;
+	static int getPositionIndex(const Component*);
+	static void setPositionIndex(Component*, const int);
+	static int markPositionDirty(Component*);
+	static void markAncestors(Component*);
+	static bool isPositionDirty(const Component*);
+	int firstDirtyChild();
+	static void setPosition(Component*, const Position&);
+	static int innerExtent(const int, const int);
 	const Position* getPosition();
 	const Style* getStyle() const;
+	static const Style* getStyle(const Component*);
+	virtual const std::basic_string<char>& getText() const;
+	virtual int layoutChildren();
+	virtual bool onClick(const int, const int);
+	virtual const Viewport* getViewport();
+	virtual Size onMeasure(const Constraint&);
+	void invalidateContent();	// text or the like changed, relayouts if the size was measured
 
 public:
 	Component(Context*);
 	Component(Container*);
+	virtual ~Component();
 
 	Context* getContext();
 
 	bool isStateActive() const;
 	bool isStateFocus() const;
 
-	void invalidatePosition();
+	bool eventClick(const int, const int);
+
+	/* lifecycle, a detached subtree keeps its state and can be attached again */
+	void detach();
+	void reattach(Container*);
+	static void destroy(Component*);
+
+	void invalidatePosition();	// moved, recomputes the subtree
+	void invalidateSize();		// resized, the parent decides which siblings follow
+	static int layout(Component*);
+	static Size measure(Component*, const Constraint&);
 	virtual std::vector<Component*>* contents() = 0;
 //	virtual void onDraw(const Display*) = 0;
-	void onDraw(const FrontendOut*);
+	virtual void onDraw(const FrontendOut*);
+	static void draw(Component*, const FrontendOut*);
 
 	/* component traversing */
 	static bool traverseExclusive(Component*, TraverseCondition (*)(Component*, void*), void*, std::vector<Component*>*);
@@ -80,6 +155,122 @@ public:
 	static std::vector<Component*> findComponentsExclusive(Component*, TraverseCondition (*)(Component*, void*), void*);
 	static std::vector<Component*> findComponentsInclusive(Component*, TraverseCondition (*)(Component*, void*), void*);
 
+	/* stackless traversing, the visitor returns a TraverseCondition and both break
+	 * conditions stop, notMatchSkip passes over the children in pre order, returns false
+	 * when stopped */
+	template<typename F>
+	static bool visitExclusive(Component*, F, const TraverseOrder = TraverseOrder::pre);
+	template<typename F>
+	static bool visitInclusive(Component*, F, const TraverseOrder = TraverseOrder::pre);
+
+	/* depth first ranges, for (Component *c : Component::subtree(root)) */
+	class Iterator;
+	class Range;
+	static Range subtree(Component*);
+	static Range descendants(Component*);
+
+};
+
+
+/*
+ * ******************************************************** traversing
+ */
+
+class Component::Iterator {
+
+private:
+	Component *current;
+	const Component *root;
+
+public:
+	Iterator(Component *c, const Component *r) : current(c), root(r) {
+	}
+
+	Component* operator*() const {
+		return current;
+	}
+
+	Iterator& operator++() {
+		current = nextPreOrder(current, root);
+		return *this;
+	}
+
+	bool operator==(const Iterator &other) const {
+		return current == other.current;
+	}
+
+	bool operator!=(const Iterator &other) const {
+		return current != other.current;
+	}
+
+};
+
+class Component::Range {
+
+private:
+	Component *first;
+	const Component *root;
+
+public:
+	Range(Component *f, const Component *r) : first(f), root(r) {
+	}
+
+	Iterator begin() const {
+		return Iterator(first, root);
+	}
+
+	Iterator end() const {
+		return Iterator(nullptr, root);
+	}
+
 };
 
+inline bool Component::isBreak(const TraverseCondition condition) {
+	return condition == TraverseCondition::matchBreak || condition == TraverseCondition::notMatchBreak;
+}
+
+inline Component::Range Component::subtree(Component *c) {
+	return Range(c, c);
+}
+
+inline Component::Range Component::descendants(Component *c) {
+	return Range(nextPreOrder(c, c), c);
+}
+
+template<typename F>
+bool Component::visitExclusive(Component *c, F visitor, const TraverseOrder order) {
+	if (order == TraverseOrder::pre) {
+		for (Component *current = nextPreOrder(c, c); current != nullptr; ) {
+			const TraverseCondition condition = visitor(current);
+			if (isBreak(condition))
+				return false;
+			current = condition == TraverseCondition::notMatchSkip ? nextPreOrderSkip(current, c) :
+			    nextPreOrder(current, c);
+		}
+		return true;
+	}
+	for (Component *current = firstPostOrder(c); current != c; current = nextPostOrder(current, c))
+		if (isBreak(visitor(current)))
+			return false;
+	return true;
+}
+
+template<typename F>
+bool Component::visitInclusive(Component *c, F visitor, const TraverseOrder order) {
+	if (order == TraverseOrder::pre) {
+		for (Component *current = c; current != nullptr; ) {
+			const TraverseCondition condition = visitor(current);
+			if (isBreak(condition))
+				return false;
+			current = condition == TraverseCondition::notMatchSkip ? nextPreOrderSkip(current, c) :
+			    nextPreOrder(current, c);
+		}
+		return true;
+	}
+	for (Component *current = firstPostOrder(c); current != nullptr; current = nextPostOrder(current, c))
+		if (isBreak(visitor(current)))
+			return false;
+	return true;
+}
+
 #endif // SWF_CORE_COMPONENT
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <vector>
+
+#include "ComponentStore.hpp"
+
+#include "FrontendOut.hpp"
+#include "Profile.hpp"
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+ComponentStore::ComponentStore() {
+	stale = true;
+	viewport = false;
+}
+
+ComponentStore::~ComponentStore() {
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// appends a component, the position is filled by update
+void ComponentStore::push(Component *c, const int parent) {
+	components.push_back(c);
+	positions.push_back({0, 0, 0, 0, 0, 0});
+	styles.push_back(c->style);
+	parents.push_back(parent);
+	ends.push_back(0);
+	texts.push_back(&c->getText());
+	if (c->getViewport() != nullptr)
+		viewport = true;
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// copies the tree below root, returns the number of stored components
+int ComponentStore::build(Component *root) {
+	SWF_ZONE("ComponentStore::build");
+	clear();
+	if (root == nullptr)
+		return 0;
+	stale = false;
+	// explicit stack of (id, next child), deep trees do not recurse
+	std::vector<std::pair<int,std::size_t>> stack;
+	push(root, -1);
+	stack.push_back({0, 0});
+	while (!stack.empty()) {
+		std::pair<int,std::size_t> &top = stack.back();
+		const std::vector<Component*> *cs = components[top.first]->contents();
+		if (top.second == cs->size()) {
+			ends[top.first] = components.size();
+			stack.pop_back();
+			continue;
+		}
+		Component *child = (*cs)[top.second++];
+		const int id = components.size();
+		push(child, top.first);
+		stack.push_back({id, 0});
+	}
+	// laying out all of a viewport would defeat its culling
+	if (!viewport)
+		update();
+	return components.size();
+}
+
+// lays out the tree and copies all positions, styles and texts are copied again as
+// well, layout may add or remove components and leave the store stale
+void ComponentStore::update() {
+	SWF_ZONE("ComponentStore::update");
+	if (stale || viewport || components.empty())
+		return;
+	Component::layout(components[0]);
+	if (stale)
+		return;
+	for (std::size_t i = 0; i < components.size(); i++) {
+		const Position *p = components[i]->getPosition();
+		if (p != nullptr)
+			positions[i] = *p;
+		styles[i] = components[i]->style;
+		texts[i] = &components[i]->getText();
+	}
+}
+
+void ComponentStore::clear() {
+	components.clear();
+	positions.clear();
+	styles.clear();
+	parents.clear();
+	ends.clear();
+	texts.clear();
+	stale = true;
+	viewport = false;
+}
+
+bool ComponentStore::isStale() const {
+	return stale;
+}
+
+bool ComponentStore::hasViewport() const {
+	return viewport;
+}
+
+// the stored pointers may dangle, the context calls this when the contents change
+void ComponentStore::markStale() {
+	stale = true;
+}
+
+// draws like a traversal of the tree, the root is not drawn, a stale store draws
+// nothing and a tree with a viewport is drawn through the tree
+void ComponentStore::draw(const FrontendOut *out) const {
+	SWF_ZONE("ComponentStore::draw");
+	if (stale)
+		return;
+	if (viewport) {
+		Component::draw(components[0], out);
+		return;
+	}
+	for (std::size_t i = 1; i < positions.size(); i++)
+		out->draw(positions[i], styles[i], *texts[i]);
+}
+
+// draws only components intersecting the area, children may overflow their parents so
+// every component is tested on its own
+void ComponentStore::drawVisible(const FrontendOut *out, const Position &area) const {
+	SWF_ZONE("ComponentStore::drawVisible");
+	if (stale || viewport) {
+		draw(out);
+		return;
+	}
+	for (std::size_t i = 1; i < positions.size(); i++) {
+		const Position &p = positions[i];
+		if (p.x >= area.x + area.w || p.x + p.w <= area.x || p.y >= area.y + area.h || p.y + p.h <= area.y)
+			continue;
+		out->draw(p, styles[i], *texts[i]);
+	}
+}
+
+// id of the last component in tree order containing the point, the topmost drawn, or -1
+int ComponentStore::find(const int x, const int y) const {
+	if (stale || viewport)
+		return -1;
+	for (int i = positions.size() - 1; i >= 0; i--) {
+		const Position &p = positions[i];
+		if (x >= p.x && x < p.x + p.w && y >= p.y && y < p.y + p.h)
+			return i;
+	}
+	return -1;
+}
+
+
+/*
+ * getter
+ */
+
+int ComponentStore::size() const {
+	return components.size();
+}
+
+Component* ComponentStore::getComponent(const int id) const {
+	return components[id];
+}
+
+const Position& ComponentStore::getPosition(const int id) const {
+	return positions[id];
+}
+
+int ComponentStore::getParent(const int id) const {
+	return parents[id];
+}
+
+int ComponentStore::getEnd(const int id) const {
+	return ends[id];
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_COMPONENT_STORE
+#define SWF_CORE_COMPONENT_STORE
+
+#include <string>
+#include <vector>
+
+#include "Component.hpp"
+
+class FrontendOut;
+
+// flat copy of a component tree in depth first order, the id of a component is its
+// index, layout results are streamed from contiguous arrays for drawing and hit tests,
+// the tree stays the owner and the store has to be rebuilt after adding or removing
+// components, until then it is stale and must not be used, positions are stored as laid
+// out, so a tree with a viewport cannot be drawn from the store
+class ComponentStore {
+
+private:
+	std::vector<Component*> components;
+	std::vector<Position> positions;
+	std::vector<Style> styles;
+	std::vector<int> parents;		// id of the parent, -1 for the root
+	std::vector<int> ends;			// one past the last descendant, skips a subtree
+	std::vector<const std::basic_string<char>*> texts;
+	bool stale;				// components were added or removed since the build
+	bool viewport;				// a component shows its contents through a viewport
+
+	void push(Component*, const int);
+
+public:
+	ComponentStore();
+	~ComponentStore();
+
+	int build(Component*);
+	void update();
+	void clear();
+	bool isStale() const;
+	void markStale();
+	bool hasViewport() const;
+
+	void draw(const FrontendOut*) const;
+	void drawVisible(const FrontendOut*, const Position&) const;
+	int find(const int, const int) const;
+
+	// getter
+	int size() const;
+	Component* getComponent(const int) const;
+	const Position& getPosition(const int) const;
+	int getParent(const int) const;
+	int getEnd(const int) const;
+
+};
+
+#endif // SWF_CORE_COMPONENT_STORE
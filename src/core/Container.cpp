@@ -19,6 +19,7 @@
 #include "Container.hpp"
 
 #include "Context.hpp"
+#include "Profile.hpp"
 //#include "Display.hpp"
 
 
@@ -40,14 +41,68 @@ Container::~Container() {
 
 
 /*
- * private
+ * protected
  */
 
 void Container::addToContents(Component *c) {
+	setPositionIndex(c, components.size());
 	components.push_back(c);
+	getContext()->contentsChanged();
+	invalidateContent();
 	SWFLOG(getContext(), LOG_DEBUG, "new size %ld", contents()->size());
 }
 
+// later siblings move up by one index and are laid out again
+void Container::removeFromContents(Component *c) {
+	const int index = getPositionIndex(c);
+	components.erase(components.begin() + index);
+	invalidateContent();
+	int count = 0;
+	for (std::size_t i = index; i < components.size(); i++) {
+		setPositionIndex(components[i], i);
+		count += markPositionDirty(components[i]);
+	}
+	if (index < (int) components.size())
+		markAncestors(components[index]);
+	getContext()->layoutCount(0, count);
+	SWFLOG(getContext(), LOG_DEBUG, "new size %ld", contents()->size());
+}
+
+// places all dirty children in one sweep, layouts with closed form rects override this
+int Container::layoutChildren() {
+	SWF_ZONE("Container::layoutChildren");
+	if (getPosition() == nullptr)
+		return 0;
+	int count = 0;
+	Position childPos;
+	for (std::size_t i = firstDirtyChild(); i < components.size(); i++) {
+		Component *c = components[i];
+		if (!isPositionDirty(c))
+			continue;
+		calculatePosition(i, *getStyle(c), &childPos);
+		setPosition(c, childPos);
+		count++;
+	}
+	getContext()->layoutCount(count, 0);
+	return count;
+}
+
+
+// the children stacked, as wide as the widest
+Size Container::onMeasure(const Constraint &constraint) {
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const Constraint inner {innerExtent(constraint.w, space), extentUnbounded};
+	int w = 0;
+	long long h = 0;
+	for (Component *c : components) {
+		const Size s = measure(c, inner);
+		w = std::max(w, s.w);
+		h += s.h;
+	}
+	return { std::min(w + 2 * space, constraint.w), (int) std::min(h + 2 * space, (long long) constraint.h) };
+}
+
 
 /*
  * public
@@ -57,6 +112,14 @@ std::vector<Component*>* Container::contents() {
 	return &components;
 }
 
+// a child changed its size, without knowing the layout all later siblings may move
+void Container::onContentsResized(Component *c) {
+	int count = 0;
+	for (std::size_t i = getPositionIndex(c) + 1; i < components.size(); i++)
+		count += markPositionDirty(components[i]);
+	getContext()->layoutCount(0, count);
+}
+
 /*
 void Container::onDraw(const Display *display) {
 //	std::pair<int,int> *offset = getOffset();
@@ -28,10 +28,13 @@ class Container : public Component {
 private:
 	std::vector<Component*> components;
 
-	void addToContents(Component*) override;
 //	void onDraw(const Display*) override;
 
 protected:
+	void addToContents(Component*) override;
+	void removeFromContents(Component*) override;
+	int layoutChildren() override;
+	Size onMeasure(const Constraint&) override;
 
 public:
 	Container(Context*);
@@ -41,6 +44,7 @@ public:
 	std::vector<Component*>* contents() override;
 
 	virtual void calculatePosition(const int, const Style&, Position*) = 0;
+	virtual void onContentsResized(Component*);
 
 };
 
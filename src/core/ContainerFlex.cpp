@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "ContainerFlex.hpp"
+
+#include "Context.hpp"
+#include "Profile.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "CONTAINER_FLEX";
+
+
+// the min limit wins over the max limit
+static int clampExtent(const int v, const int min, const int max) {
+	return std::max(std::min(v, max), std::max(min, 0));
+}
+
+
+/*
+ * constructor, destructor
+ */
+
+ContainerFlex::ContainerFlex(Context *ctx) : Container(ctx) {
+	direction = DIRECTION_ROW;
+	gap = 0;
+	stretch = true;
+	arrangedFor = {0, 0, 0, 0, 0, 0};
+	arrangedEpoch = 0;
+	isArranged = false;
+}
+
+ContainerFlex::ContainerFlex(Container *c) : Container(c) {
+	direction = DIRECTION_ROW;
+	gap = 0;
+	stretch = true;
+	arrangedFor = {0, 0, 0, 0, 0, 0};
+	arrangedEpoch = 0;
+	isArranged = false;
+}
+
+ContainerFlex::~ContainerFlex() {
+}
+
+
+/*
+ * private
+ */
+
+// new children neither grow nor go below their measured size when shrinking; the add
+// leaves the container dirty and with it every child, so building stays linear
+void ContainerFlex::addToContents(Component *c) {
+	Container::addToContents(c);
+	items.push_back({0, 1, 0, 0, extentUnbounded, extentUnbounded});
+	if (!isPositionDirty(this)) {
+		invalidateArrangement();
+		return;
+	}
+	isArranged = false;
+	getContext()->layoutCount(0, markPositionDirty(c));
+	markAncestors(c);
+}
+
+void ContainerFlex::removeFromContents(Component *c) {
+	items.erase(items.begin() + getPositionIndex(c));
+	Container::removeFromContents(c);
+	invalidateArrangement();
+}
+
+void ContainerFlex::calculatePosition(const int childIndex, const Style &childStyle, Position *childPos) {
+	SWF_ZONE("ContainerFlex::calculatePosition");
+	const Position inner = innerPosition();
+	if (!isArrangedFor(inner))
+		arrange(inner);
+	*childPos = arranged[childIndex];
+	SWFLOG(getContext(), LOG_DEBUG, "%d+%d %dx%d", childPos->x, childPos->y, childPos->w, childPos->h);
+}
+
+// a child size moves all siblings
+void ContainerFlex::onContentsResized(Component *c) {
+	invalidateArrangement();
+}
+
+Position ContainerFlex::innerPosition() {
+	const Position *pos = getPosition();
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	return { pos->x + space, pos->y + space, std::max(pos->w - 2 * space, 0), std::max(pos->h - 2 * space, 0),
+	    0, 0 };
+}
+
+// a font change makes the measures stale without any child resized
+bool ContainerFlex::isArrangedFor(const Position &inner) {
+	return isArranged && arrangedEpoch == getContext()->getMeasureEpoch() && inner.x == arrangedFor.x &&
+	    inner.y == arrangedFor.y && inner.w == arrangedFor.w && inner.h == arrangedFor.h;
+}
+
+// measures the children across the line with the main axis open, the measures stay
+// cached when only the main axis of the container changes
+void ContainerFlex::arrange(const Position &inner) {
+	SWF_ZONE("ContainerFlex::arrange");
+	const std::vector<Component*> &cs = *contents();
+	const int n = cs.size();
+	const bool row = direction == DIRECTION_ROW;
+	const int mainExtent = row ? inner.w : inner.h;
+	const int crossExtent = row ? inner.h : inner.w;
+	const Constraint constraint = row ? Constraint {extentUnbounded, crossExtent} :
+	    Constraint {crossExtent, extentUnbounded};
+	slots.resize(n);
+	arranged.resize(n);
+	for (int i = 0; i < n; i++) {
+		const Size s = measure(cs[i], constraint);
+		const Item &it = items[i];
+		const int base = row ? clampExtent(s.w, it.minW, it.maxW) : clampExtent(s.h, it.minH, it.maxH);
+		slots[i] = {base, base, row ? s.h : s.w, false};
+	}
+	resolve(mainExtent - gap * std::max(n - 1, 0));
+	int cursor = 0;
+	for (int i = 0; i < n; i++) {
+		const Item &it = items[i];
+		const int cross = stretch ? crossExtent : std::min(slots[i].cross, crossExtent);
+		const int size = std::max(slots[i].size, 1);
+		if (row)
+			arranged[i] = {inner.x + cursor, inner.y, size, std::max(clampExtent(cross, it.minH, it.maxH), 1), 0, 0};
+		else
+			arranged[i] = {inner.x, inner.y + cursor, std::max(clampExtent(cross, it.minW, it.maxW), 1), size, 0, 0};
+		cursor += slots[i].size + gap;
+	}
+	arrangedFor = inner;
+	arrangedEpoch = getContext()->getMeasureEpoch();
+	isArranged = true;
+	SWFLOG(getContext(), LOG_DEBUG, "%d children in %dx%d", n, inner.w, inner.h);
+}
+
+// hands the free space out to the slots by grow factor or takes the missing space by
+// shrink factor times base, slots hitting a limit are frozen there and the rest is
+// handed out again, each round freezes at least one slot
+void ContainerFlex::resolve(const int available) {
+	const bool row = direction == DIRECTION_ROW;
+	const int n = slots.size();
+	long long bases = 0;
+	for (const Slot &s : slots)
+		bases += s.base;
+	const bool growing = available > bases;
+	for (int i = 0; i < n; i++) {
+		Slot &s = slots[i];
+		s.size = s.base;
+		s.frozen = available == bases || (growing ? items[i].grow == 0 : items[i].shrink == 0 || s.base == 0);
+	}
+	for (;;) {
+		long long free = available;
+		long long weights = 0;
+		for (int i = 0; i < n; i++) {
+			free -= slots[i].frozen ? slots[i].size : slots[i].base;
+			if (!slots[i].frozen)
+				weights += growing ? items[i].grow : (long long) items[i].shrink * slots[i].base;
+		}
+		if (weights == 0)
+			return;
+		// shares as differences of rounded prefixes, the sizes add up exactly
+		long long weight = 0;
+		long long previous = 0;
+		long long violation = 0;
+		for (int i = 0; i < n; i++) {
+			Slot &s = slots[i];
+			if (s.frozen)
+				continue;
+			weight += growing ? items[i].grow : (long long) items[i].shrink * s.base;
+			const long long share = free * weight / weights;
+			s.size = s.base + (int) (share - previous);
+			previous = share;
+			const Item &it = items[i];
+			violation += (row ? clampExtent(s.size, it.minW, it.maxW) : clampExtent(s.size, it.minH, it.maxH)) - s.size;
+		}
+		if (violation == 0)
+			return;
+		for (int i = 0; i < n; i++) {
+			Slot &s = slots[i];
+			if (s.frozen)
+				continue;
+			const Item &it = items[i];
+			const int clamped = row ? clampExtent(s.size, it.minW, it.maxW) : clampExtent(s.size, it.minH, it.maxH);
+			if ((violation > 0 && clamped > s.size) || (violation < 0 && clamped < s.size)) {
+				s.size = clamped;
+				s.frozen = true;
+			}
+		}
+	}
+}
+
+// every child moves, the arrangement is done again on the next layout
+void ContainerFlex::invalidateArrangement() {
+	isArranged = false;
+	const std::vector<Component*> &cs = *contents();
+	int count = 0;
+	for (Component *c : cs)
+		count += markPositionDirty(c);
+	if (!cs.empty())
+		markAncestors(cs[0]);
+	getContext()->layoutCount(0, count);
+}
+
+ContainerFlex::Item* ContainerFlex::findItem(Component *c) {
+	const int index = getPositionIndex(c);
+	if (index < 0 || index >= (int) items.size() || (*contents())[index] != c) {
+		SWFLOG(getContext(), LOG_WARN, "not in contents");
+		return nullptr;
+	}
+	return &items[index];
+}
+
+
+/*
+ * protected
+ */
+
+// arranges once for all dirty children
+int ContainerFlex::layoutChildren() {
+	SWF_ZONE("ContainerFlex::layoutChildren");
+	if (getPosition() == nullptr)
+		return 0;
+	const Position inner = innerPosition();
+	if (!isArrangedFor(inner))
+		arrange(inner);
+	const std::vector<Component*> &cs = *contents();
+	int count = 0;
+	for (std::size_t i = firstDirtyChild(); i < cs.size(); i++) {
+		if (!isPositionDirty(cs[i]))
+			continue;
+		setPosition(cs[i], arranged[i]);
+		count++;
+	}
+	getContext()->layoutCount(count, 0);
+	SWFLOG(getContext(), LOG_DEBUG, "%d of %ld", count, cs.size());
+	return count;
+}
+
+// the children in a line at their limited bases, across as large as the largest
+Size ContainerFlex::onMeasure(const Constraint &constraint) {
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const bool row = direction == DIRECTION_ROW;
+	const int cross = innerExtent(row ? constraint.h : constraint.w, space);
+	const Constraint inner = row ? Constraint {extentUnbounded, cross} : Constraint {cross, extentUnbounded};
+	const std::vector<Component*> &cs = *contents();
+	long long main = 2 * space + gap * std::max((long long) cs.size() - 1, 0LL);
+	int across = 0;
+	for (std::size_t i = 0; i < cs.size(); i++) {
+		const Size s = measure(cs[i], inner);
+		const Item &it = items[i];
+		main += row ? clampExtent(s.w, it.minW, it.maxW) : clampExtent(s.h, it.minH, it.maxH);
+		across = std::max(across, row ? clampExtent(s.h, it.minH, it.maxH) : clampExtent(s.w, it.minW, it.maxW));
+	}
+	const int w = (int) std::min(row ? main : (long long) across + 2 * space, (long long) constraint.w);
+	const int h = (int) std::min(row ? (long long) across + 2 * space : main, (long long) constraint.h);
+	return { w, h };
+}
+
+
+/*
+ * getter / setter
+ */
+
+ContainerFlex::Direction ContainerFlex::getDirection() const {
+	return direction;
+}
+
+void ContainerFlex::setDirection(const Direction d) {
+	direction = d;
+	invalidateArrangement();
+	invalidateSize();
+}
+
+int ContainerFlex::getGap() const {
+	return gap;
+}
+
+void ContainerFlex::setGap(const int g) {
+	gap = std::max(g, 0);
+	invalidateArrangement();
+	invalidateSize();
+}
+
+bool ContainerFlex::isStretch() const {
+	return stretch;
+}
+
+void ContainerFlex::setStretch(const bool s) {
+	stretch = s;
+	invalidateArrangement();
+	invalidateSize();
+}
+
+// share of the free space, 0 keeps the measured size
+void ContainerFlex::setGrow(Component *c, const int grow) {
+	Item *it = findItem(c);
+	if (it == nullptr)
+		return;
+	it->grow = std::max(grow, 0);
+	invalidateArrangement();
+}
+
+// share of the missing space relative to the measured size, 0 never shrinks
+void ContainerFlex::setShrink(Component *c, const int shrink) {
+	Item *it = findItem(c);
+	if (it == nullptr)
+		return;
+	it->shrink = std::max(shrink, 0);
+	invalidateArrangement();
+}
+
+void ContainerFlex::setMinSize(Component *c, const int w, const int h) {
+	Item *it = findItem(c);
+	if (it == nullptr)
+		return;
+	it->minW = std::max(w, 0);
+	it->minH = std::max(h, 0);
+	invalidateArrangement();
+	invalidateSize();
+}
+
+// extentUnbounded lifts a limit
+void ContainerFlex::setMaxSize(Component *c, const int w, const int h) {
+	Item *it = findItem(c);
+	if (it == nullptr)
+		return;
+	it->maxW = std::max(w, 0);
+	it->maxH = std::max(h, 0);
+	invalidateArrangement();
+	invalidateSize();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_CONTAINER_FLEX
+#define SWF_CORE_CONTAINER_FLEX
+
+#include <vector>
+
+#include "Component.hpp"
+#include "Container.hpp"
+
+// lays its children out in one row or column, each child is measured for its basis,
+// free space is handed out by the grow factors and missing space taken by the shrink
+// factors weighted with the basis, sizes are held within the min and max limits of the
+// child, across the line children stretch to the container unless told not to
+class ContainerFlex : public Container {
+
+public:
+	enum Direction { DIRECTION_ROW, DIRECTION_COLUMN };
+
+private:
+	struct Item {
+		int grow, shrink;
+		int minW, minH, maxW, maxH;
+	};
+	struct Slot {
+		int base, size, cross;
+		bool frozen;
+	};
+
+	Direction direction;
+	int gap;
+	bool stretch;
+	std::vector<Item> items;		// parallel to the contents
+	std::vector<Slot> slots;		// scratch of the arrangement, kept to not allocate
+	std::vector<Position> arranged;		// rects of the children for arrangedFor
+	Position arrangedFor;			// inner rect the children were arranged in
+	int arrangedEpoch;			// measure epoch of the context at the arrangement
+	bool isArranged;
+
+	void addToContents(Component*) override;
+	void removeFromContents(Component*) override;
+	void calculatePosition(const int, const Style&, Position*) override;
+	void onContentsResized(Component*) override;
+	Position innerPosition();
+	bool isArrangedFor(const Position&);
+	void arrange(const Position&);
+	void resolve(const int);
+	void invalidateArrangement();
+	Item* findItem(Component*);
+
+protected:
+	int layoutChildren() override;
+	Size onMeasure(const Constraint&) override;
+
+public:
+	ContainerFlex(Context*);
+	ContainerFlex(Container*);
+	~ContainerFlex();
+
+	// getter / setter
+	Direction getDirection() const;
+	void setDirection(const Direction);
+	int getGap() const;
+	void setGap(const int);
+	bool isStretch() const;
+	void setStretch(const bool);
+	void setGrow(Component*, const int);
+	void setShrink(Component*, const int);
+	void setMinSize(Component*, const int, const int);
+	void setMaxSize(Component*, const int, const int);
+
+};
+
+#endif // SWF_CORE_CONTAINER_FLEX
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "ContainerGrid.hpp"
+
+#include "Context.hpp"
+#include "FrontendOut.hpp"
+#include "Profile.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "CONTAINER_GRID";
+
+
+/*
+ * constructor, destructor
+ */
+
+ContainerGrid::ContainerGrid(Context *ctx) : Container(ctx) {
+	columns.assign(1, {0, 1});
+	tracksWidth = -1;
+	tracksHeight = -1;
+	rowHeight = 0;
+}
+
+ContainerGrid::ContainerGrid(Container *c) : Container(c) {
+	columns.assign(1, {0, 1});
+	tracksWidth = -1;
+	tracksHeight = -1;
+	rowHeight = 0;
+}
+
+ContainerGrid::~ContainerGrid() {
+}
+
+
+/*
+ * private
+ */
+
+// new children flow into the next cell
+void ContainerGrid::addToContents(Component *c) {
+	Container::addToContents(c);
+	cells.push_back({-1, 0, 1, 1});
+}
+
+void ContainerGrid::removeFromContents(Component *c) {
+	cells.erase(cells.begin() + getPositionIndex(c));
+	Container::removeFromContents(c);
+}
+
+void ContainerGrid::calculatePosition(const int childIndex, const Style &childStyle, Position *childPos) {
+	SWF_ZONE("ContainerGrid::calculatePosition");
+	const Position *pos = getPosition();
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const Position inner {pos->x + space, pos->y + space, pos->w - 2 * space, pos->h - 2 * space, 0, 0};
+	updateTracks(inner);
+	const int n = columns.size();
+	Cell cell = cells[childIndex];
+	if (cell.column < 0)
+		cell = {childIndex % n, childIndex / n, 1, 1};
+	cellPosition(cell, inner, childPos);
+	SWFLOG(getContext(), LOG_DEBUG, "%d+%d %dx%d", childPos->x, childPos->y, childPos->w, childPos->h);
+}
+
+// cells do not depend on the size of their neighbours
+void ContainerGrid::onContentsResized(Component *c) {
+}
+
+// offsets of the tracks over the extent, fixed tracks first, the rest is shared by
+// weight, each offset is rounded on its own so the errors do not add up
+void ContainerGrid::trackStarts(const std::vector<Track> &tracks, const int extent, std::vector<int> *starts) {
+	int fixed = 0;
+	int weights = 0;
+	for (const Track &t : tracks) {
+		fixed += t.size;
+		if (t.size == 0)
+			weights += t.weight;
+	}
+	const long long remaining = std::max(extent - fixed, 0);
+	starts->resize(tracks.size() + 1);
+	fixed = 0;
+	int weight = 0;
+	(*starts)[0] = 0;
+	for (std::size_t i = 0; i < tracks.size(); i++) {
+		fixed += tracks[i].size;
+		if (tracks[i].size == 0)
+			weight += tracks[i].weight;
+		(*starts)[i + 1] = fixed + (weights > 0 ? remaining * weight / weights : 0);
+	}
+}
+
+void ContainerGrid::updateTracks(const Position &inner) {
+	const Style *stl = getStyle();
+	const int height = getContext()->getFrontendOut()->fontDimension().second + 2 * (stl->margin + stl->padding);
+	if (inner.w == tracksWidth && inner.h == tracksHeight && height == rowHeight)
+		return;
+	trackStarts(columns, inner.w, &columnStart);
+	trackStarts(rows, inner.h, &rowStart);
+	tracksWidth = inner.w;
+	tracksHeight = inner.h;
+	rowHeight = height;
+	SWFLOG(getContext(), LOG_DEBUG, "%dx%d %ldx%ld tracks", inner.w, inner.h, columns.size(), rows.size());
+}
+
+// spans are cut at the last column, rows past the tracks have the font height
+void ContainerGrid::cellPosition(const Cell &cell, const Position &inner, Position *childPos) const {
+	const int n = columns.size();
+	const int m = rows.size();
+	const int c0 = std::min(cell.column, n - 1);
+	const int c1 = std::min(cell.column + cell.columnSpan, n);
+	const int r0 = cell.row;
+	const int r1 = cell.row + cell.rowSpan;
+	const int y0 = r0 <= m ? rowStart[r0] : rowStart[m] + (r0 - m) * rowHeight;
+	const int y1 = r1 <= m ? rowStart[r1] : rowStart[m] + (r1 - m) * rowHeight;
+	childPos->x = inner.x + columnStart[c0];
+	childPos->y = inner.y + y0;
+	childPos->w = std::max(columnStart[c1] - columnStart[c0], 1);
+	childPos->h = std::max(y1 - y0, 1);
+}
+
+// tracks changed, every cell moves
+void ContainerGrid::invalidateCells() {
+	tracksWidth = -1;
+	const std::vector<Component*> &cs = *contents();
+	int count = 0;
+	for (Component *c : cs)
+		count += markPositionDirty(c);
+	if (!cs.empty())
+		markAncestors(cs[0]);
+	getContext()->layoutCount(0, count);
+}
+
+void ContainerGrid::setTrack(std::vector<Track> *tracks, const int index, const int size, const int weight) {
+	if (index < 0 || index >= (int) tracks->size()) {
+		SWFLOG(getContext(), LOG_WARN, "track %d of %ld", index, tracks->size());
+		return;
+	}
+	(*tracks)[index] = {std::max(size, 0), std::max(weight, 0)};
+	invalidateCells();
+}
+
+
+/*
+ * protected
+ */
+
+// same rects as calculatePosition, the tracks are updated once and the flow cell is
+// counted along instead of divided out
+int ContainerGrid::layoutChildren() {
+	SWF_ZONE("ContainerGrid::layoutChildren");
+	const Position *pos = getPosition();
+	if (pos == nullptr)
+		return 0;
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const Position inner {pos->x + space, pos->y + space, pos->w - 2 * space, pos->h - 2 * space, 0, 0};
+	updateTracks(inner);
+	const int n = columns.size();
+	const std::vector<Component*> &cs = *contents();
+	const int first = firstDirtyChild();
+	Cell flow {first % n, first / n, 1, 1};
+	Position childPos;
+	int count = 0;
+	for (std::size_t i = first; i < cs.size(); i++) {
+		if (isPositionDirty(cs[i])) {
+			cellPosition(cells[i].column < 0 ? flow : cells[i], inner, &childPos);
+			setPosition(cs[i], childPos);
+			count++;
+		}
+		if (++flow.column == n) {
+			flow.column = 0;
+			flow.row++;
+		}
+	}
+	getContext()->layoutCount(count, 0);
+	SWFLOG(getContext(), LOG_DEBUG, "%d of %ld", count, cs.size());
+	return count;
+}
+
+
+/*
+ * getter / setter
+ */
+
+int ContainerGrid::getColumnCount() const {
+	return columns.size();
+}
+
+// at least one column, all share the width equally
+void ContainerGrid::setColumnCount(const int count) {
+	columns.assign(std::max(count, 1), {0, 1});
+	invalidateCells();
+}
+
+// a fixed width in pixels, 0 sizes the column by its weight again
+void ContainerGrid::setColumnSize(const int column, const int size) {
+	setTrack(&columns, column, size, column >= 0 && column < (int) columns.size() ? columns[column].weight : 0);
+}
+
+void ContainerGrid::setColumnWeight(const int column, const int weight) {
+	setTrack(&columns, column, 0, weight);
+}
+
+int ContainerGrid::getRowCount() const {
+	return rows.size();
+}
+
+// rows share the height equally, with no rows every row has the font height
+void ContainerGrid::setRowCount(const int count) {
+	rows.assign(std::max(count, 0), {0, 1});
+	invalidateCells();
+}
+
+void ContainerGrid::setRowSize(const int row, const int size) {
+	setTrack(&rows, row, size, row >= 0 && row < (int) rows.size() ? rows[row].weight : 0);
+}
+
+void ContainerGrid::setRowWeight(const int row, const int weight) {
+	setTrack(&rows, row, 0, weight);
+}
+
+// places a child at a cell spanning columns and rows, other children may overlap it
+void ContainerGrid::setCell(Component *c, const int column, const int row, const int columnSpan, const int rowSpan) {
+	const int index = getPositionIndex(c);
+	if (index < 0 || index >= (int) cells.size() || (*contents())[index] != c) {
+		SWFLOG(getContext(), LOG_WARN, "not in contents");
+		return;
+	}
+	cells[index] = {std::max(column, 0), std::max(row, 0), std::max(columnSpan, 1), std::max(rowSpan, 1)};
+	getContext()->layoutCount(0, markPositionDirty(c));
+	markAncestors(c);
+}
+
+// the child flows by its index again
+void ContainerGrid::clearCell(Component *c) {
+	const int index = getPositionIndex(c);
+	if (index < 0 || index >= (int) cells.size() || (*contents())[index] != c) {
+		SWFLOG(getContext(), LOG_WARN, "not in contents");
+		return;
+	}
+	cells[index] = {-1, 0, 1, 1};
+	getContext()->layoutCount(0, markPositionDirty(c));
+	markAncestors(c);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_CONTAINER_GRID
+#define SWF_CORE_CONTAINER_GRID
+
+#include <vector>
+
+#include "Component.hpp"
+#include "Container.hpp"
+
+// places its children in cells of a grid, children flow row by row in the order they
+// were added so any cell follows from the index, a child placed at an explicit cell may
+// span several columns and rows, its slot in the flow stays empty and the flow does not
+// avoid its cell, tracks have a fixed size in pixels or share the remaining space by
+// weight, rows past the row tracks have the font height
+class ContainerGrid : public Container {
+
+private:
+	struct Track {
+		int size;	// pixels, 0 when sized by weight
+		int weight;
+	};
+	struct Cell {
+		int column, row, columnSpan, rowSpan;	// column < 0 flows by index
+	};
+
+	std::vector<Track> columns;
+	std::vector<Track> rows;
+	std::vector<Cell> cells;		// parallel to the contents
+	std::vector<int> columnStart;		// offsets of the tracks, one past the last
+	std::vector<int> rowStart;
+	int tracksWidth, tracksHeight;		// inner dimension the offsets are for, -1 when stale
+	int rowHeight;				// height of the rows without tracks
+
+	void addToContents(Component*) override;
+	void removeFromContents(Component*) override;
+	void calculatePosition(const int, const Style&, Position*) override;
+	void onContentsResized(Component*) override;
+	static void trackStarts(const std::vector<Track>&, const int, std::vector<int>*);
+	void updateTracks(const Position&);
+	void cellPosition(const Cell&, const Position&, Position*) const;
+	void invalidateCells();
+	void setTrack(std::vector<Track>*, const int, const int, const int);
+
+protected:
+	int layoutChildren() override;
+
+public:
+	ContainerGrid(Context*);
+	ContainerGrid(Container*);
+	~ContainerGrid();
+
+	// getter / setter
+	int getColumnCount() const;
+	void setColumnCount(const int);
+	void setColumnSize(const int, const int);
+	void setColumnWeight(const int, const int);
+	int getRowCount() const;
+	void setRowCount(const int);
+	void setRowSize(const int, const int);
+	void setRowWeight(const int, const int);
+	void setCell(Component*, const int, const int, const int = 1, const int = 1);
+	void clearCell(Component*);
+
+};
+
+#endif // SWF_CORE_CONTAINER_GRID
@@ -21,6 +21,7 @@
 //#include "Container.hpp"
 #include "Context.hpp"
 #include "FrontendOut.hpp"
+#include "Profile.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "CONTAINER_LIST";
@@ -47,6 +48,7 @@ ContainerList::~ContainerList() {
  */
 
 void ContainerList::calculatePosition(const int childIndex, const Style &childStyle, Position *childPos) {
+	SWF_ZONE("ContainerList::calculatePosition");
 	Context *ctx = getContext();
 	const Position *pos = getPosition();
 	const Style *stl = getStyle();
@@ -58,17 +60,49 @@ void ContainerList::calculatePosition(const int childIndex, const Style &childSt
 	childPos->h = fontHeight + 2 * space;
 	childPos->x = pos->x + stl->margin + stl->padding;
 	childPos->y = pos->y + stl->margin + stl->padding + childIndex * (childPos->h + advance);
-/*
-	// columns
-	const int size = contents()->size();
-	childPos->x = pos->x + index * pos->w / size;
-	childPos->y = 0;
-	childPos->w = pos->w / size;
-	childPos->h = getContext()->getDisplay()->fontDimension().second;
-*/
 	SWFLOG(getContext(), LOG_DEBUG, "%d+%d %dx%d", childPos->x, childPos->y, childPos->w, childPos->h);
 }
 
+// rows are placed by index with the font height, a resized child moves no sibling
+void ContainerList::onContentsResized(Component *c) {
+}
+
+
+/*
+ * protected
+ */
+
+// same rects as calculatePosition, parent metrics are fetched once per sweep
+int ContainerList::layoutChildren() {
+	SWF_ZONE("ContainerList::layoutChildren");
+	const Position *pos = getPosition();
+	if (pos == nullptr)
+		return 0;
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const int fontHeight = getContext()->getFrontendOut()->fontDimension().second;
+	Position childPos;
+	childPos.w = pos->w - 2 * space;
+	if (childPos.w < 1)
+		childPos.w = 1;
+	childPos.h = fontHeight + 2 * space;
+	childPos.x = pos->x + space;
+	const int y = pos->y + space;
+	const int step = childPos.h + advance;
+	const std::vector<Component*> &cs = *contents();
+	int count = 0;
+	for (std::size_t i = firstDirtyChild(); i < cs.size(); i++) {
+		if (!isPositionDirty(cs[i]))
+			continue;
+		childPos.y = y + i * step;
+		setPosition(cs[i], childPos);
+		count++;
+	}
+	getContext()->layoutCount(count, 0);
+	SWFLOG(getContext(), LOG_DEBUG, "%d of %ld", count, cs.size());
+	return count;
+}
+
 
 /*
  * public
@@ -31,8 +31,10 @@ private:
 
 //	void onDraw(const Display*) override;
 	void calculatePosition(const int, const Style&, Position*) override;
+	void onContentsResized(Component*) override;
 
 protected:
+	int layoutChildren() override;
 
 public:
 	ContainerList(Context*);
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "ContainerListVirtual.hpp"
+
+#include "Context.hpp"
+#include "FrontendOut.hpp"
+#include "Profile.hpp"
+#include "Widget.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "CONTAINER_LIST_VIRTUAL";
+
+
+/*
+ * constructor, destructor
+ */
+
+ContainerListVirtual::ContainerListVirtual(Context *ctx) : Container(ctx) {
+	rowCount = 0;
+	overscan = 2;
+	scrollOffset = 0;
+	firstRow = 0;
+	viewport = {{0, 0, 0, 0, 0, 0}, 0, 0, 0, 0};
+	onRow = nullptr;
+	onRowUserData = nullptr;
+}
+
+ContainerListVirtual::ContainerListVirtual(Container *c) : Container(c) {
+	rowCount = 0;
+	overscan = 2;
+	scrollOffset = 0;
+	firstRow = 0;
+	viewport = {{0, 0, 0, 0, 0, 0}, 0, 0, 0, 0};
+	onRow = nullptr;
+	onRowUserData = nullptr;
+}
+
+// the list owns its rows, Component::destroy has released them already, a list on the
+// stack or deleted still holds them
+ContainerListVirtual::~ContainerListVirtual() {
+	std::vector<Component*> *cs = contents();
+	while (!cs->empty())
+		Component::destroy(cs->back());
+}
+
+
+/*
+ * private
+ */
+
+// the lazy path places a single row, the same rect layoutChildren computes
+void ContainerListVirtual::calculatePosition(const int childIndex, const Style &childStyle, Position *childPos) {
+	SWF_ZONE("ContainerListVirtual::calculatePosition");
+	const Position *pos = getPosition();
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	childPos->w = std::max(pos->w - 2 * space, 1);
+	childPos->h = rowHeight();
+	childPos->x = pos->x + space;
+	const int row = childIndex < (int) rowIndex.size() && rowIndex[childIndex] >= 0 ?
+	    rowIndex[childIndex] : firstRow + childIndex;
+	childPos->y = pos->y + space + row * childPos->h - scrollOffset;
+}
+
+// rows have a fixed height, a resized row moves no sibling
+void ContainerListVirtual::onContentsResized(Component *c) {
+}
+
+int ContainerListVirtual::rowHeight() {
+	const Style *stl = getStyle();
+	return getContext()->getFrontendOut()->fontDimension().second + 2 * (stl->margin + stl->padding);
+}
+
+
+/*
+ * protected
+ */
+
+// derives the visible range from the scroll offset, recycles the rows for it, binds the
+// rows whose data row changed and places them, the cost follows the visible rows only,
+// data row r is shown by row r modulo the row count, so while scrolling only the rows
+// coming into view are bound again
+int ContainerListVirtual::layoutChildren() {
+	SWF_ZONE("ContainerListVirtual::layoutChildren");
+	const Position *pos = getPosition();
+	if (pos == nullptr)
+		return 0;
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const int step = rowHeight();
+	const Position inner {pos->x + space, pos->y + space, std::max(pos->w - 2 * space, 1),
+	    std::max(pos->h - 2 * space, 0), pos->x + space, pos->y + space};
+	const int firstVisible = scrollOffset / step;
+	const int visible = (inner.h + step - 1) / step + 1;
+	firstRow = std::max(firstVisible - overscan, 0);
+	const int rows = std::max(std::min(firstVisible + visible + overscan, rowCount) - firstRow, 0);
+
+	// recycle, grow and shrink at the back
+	std::vector<Component*> *cs = contents();
+	while ((int) cs->size() < rows) {
+		getContext()->create<Widget>(this);
+		rowIndex.push_back(-1);
+	}
+	while ((int) cs->size() > rows) {
+		Component::destroy(cs->back());
+		rowIndex.pop_back();
+	}
+
+	// bind and place
+	Position childPos;
+	childPos.w = inner.w;
+	childPos.h = step;
+	childPos.x = inner.x;
+	int count = 0;
+	for (int row = firstRow; row < firstRow + rows; row++) {
+		const int i = row % rows;
+		Component *c = (*cs)[i];
+		if (rowIndex[i] != row) {
+			rowIndex[i] = row;
+			if (onRow != nullptr)
+				onRow((Widget*) c, row, onRowUserData);
+			else
+				((Widget*) c)->setText("");
+		}
+		if (!isPositionDirty(c))
+			continue;
+		childPos.y = inner.y + row * step - scrollOffset;
+		setPosition(c, childPos);
+		count++;
+	}
+	getContext()->layoutCount(count, 0);
+	SWFLOG(getContext(), LOG_DEBUG, "rows %d+%d of %d", firstRow, rows, rowCount);
+	return count;
+}
+
+// rows are placed on screen already, the inner rect clips the overscan rows and cuts
+// the partly visible ones, the rows are a ring so all of them are in range
+const Viewport* ContainerListVirtual::getViewport() {
+	const Position *pos = getPosition();
+	if (pos == nullptr)
+		return nullptr;
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	viewport.clip = {pos->x + space, pos->y + space, std::max(pos->w - 2 * space, 1),
+	    std::max(pos->h - 2 * space, 0), pos->x + space, pos->y + space};
+	viewport.offsetX = 0;
+	viewport.offsetY = 0;
+	viewport.first = 0;
+	viewport.last = contents()->size();
+	return &viewport;
+}
+
+
+/*
+ * public
+ */
+
+// the callback fills a recycled row with the data of the given row
+void ContainerListVirtual::setRowCallback(void (*cb)(Widget*, const int, void*), void *userData) {
+	onRow = cb;
+	onRowUserData = userData;
+	refresh();
+}
+
+// binds all rows again, after the data changed
+void ContainerListVirtual::refresh() {
+	std::fill(rowIndex.begin(), rowIndex.end(), -1);
+	invalidatePosition();
+}
+
+void ContainerListVirtual::scrollToRow(const int row) {
+	setScrollOffset(row * rowHeight());
+}
+
+// data row shown by a row of this list, -1 for other components
+int ContainerListVirtual::getRowIndex(const Component *c) const {
+	const int i = getPositionIndex(c);
+	const std::vector<Component*> *cs = ((ContainerListVirtual*) this)->contents();
+	if (i < 0 || i >= (int) rowIndex.size() || (*cs)[i] != c)
+		return -1;
+	return rowIndex[i];
+}
+
+
+/*
+ * getter / setter
+ */
+
+int ContainerListVirtual::getRowCount() const {
+	return rowCount;
+}
+
+void ContainerListVirtual::setRowCount(const int count) {
+	rowCount = std::max(count, 0);
+	std::fill(rowIndex.begin(), rowIndex.end(), -1);
+	invalidatePosition();
+}
+
+int ContainerListVirtual::getOverscan() const {
+	return overscan;
+}
+
+void ContainerListVirtual::setOverscan(const int rows) {
+	overscan = std::max(rows, 0);
+	invalidatePosition();
+}
+
+int ContainerListVirtual::getScrollOffset() const {
+	return scrollOffset;
+}
+
+// every row moves, a row keeps its binding as long as its data row stays in range
+void ContainerListVirtual::setScrollOffset(const int offset) {
+	if (offset == scrollOffset)
+		return;
+	scrollOffset = std::max(offset, 0);
+	invalidatePosition();
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_CONTAINER_LIST_VIRTUAL
+#define SWF_CORE_CONTAINER_LIST_VIRTUAL
+
+#include <vector>
+
+#include "Component.hpp"
+#include "Container.hpp"
+
+class Widget;
+
+// list of fixed height rows over a data set of row count rows, only the visible rows
+// plus overscan exist as components, they are recycled while scrolling and filled by
+// the row callback, the rows are pooled children released with the list
+class ContainerListVirtual : public Container {
+
+private:
+	int rowCount;
+	int overscan;			// rows kept above and below the visible ones
+	int scrollOffset;		// in pixels from the top of the first row
+	int firstRow;			// first data row in range
+	std::vector<int> rowIndex;	// data row bound to each child, -1 when unbound
+	Viewport viewport;		// inner rect of the list, rows outside are not drawn or hit
+	void (*onRow)(Widget*, const int, void*);
+	void *onRowUserData;
+
+	void calculatePosition(const int, const Style&, Position*) override;
+	void onContentsResized(Component*) override;
+	int rowHeight();
+
+protected:
+	int layoutChildren() override;
+	const Viewport* getViewport() override;
+
+public:
+	ContainerListVirtual(Context*);
+	ContainerListVirtual(Container*);
+	~ContainerListVirtual();
+
+	void setRowCallback(void (*)(Widget*, const int, void*), void*);
+	void refresh();
+	void scrollToRow(const int);
+	int getRowIndex(const Component*) const;
+
+	// getter / setter
+	int getRowCount() const;
+	void setRowCount(const int);
+	int getOverscan() const;
+	void setOverscan(const int);
+	int getScrollOffset() const;
+	void setScrollOffset(const int);
+
+};
+
+#endif // SWF_CORE_CONTAINER_LIST_VIRTUAL
@@ -15,37 +15,65 @@
  */
 
 #include <cstdarg>
+#include <cstring>
 #include <string>
 
 #include "Context.hpp"
 
 #include "Component.hpp"
+#include "ComponentStore.hpp"
 #include "Container.hpp"
 #include "FrontendIn.hpp"
 #include "FrontendOut.hpp"
-#ifdef _WINDOWS
-#include "../frontend/out/GdiOut.hpp"
-#endif
+#include "Profile.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "CONTEXT";
 
+// components per slab of a component pool
+static const int poolSlabSlots = 256;
+
+static const long long nanosPerSecond = 1000LL * 1000LL * 1000LL;
+
 
 /*
  * ******************************************************** constructor / destructor
  */
 
-Context::Context() {	
-	SWFLOG(this, LOG_DEBUG, nullptr);
+Context::Context() : fpsHistogram(300), phaseHistograms(PHASE_COUNT, Histogram(300)), phaseNanos(PHASE_COUNT),
+	    phaseNanosCounter(PHASE_COUNT) {
 	frontendIn = nullptr;
 	frontendOut = nullptr;
+	logLevel = LOG_DEBUG;
+	logFacilityLevels = nullptr;
+	SWFLOG(this, LOG_DEBUG, nullptr);
 	rootContainer = nullptr;
+	componentStore = nullptr;
+	layoutVersion = 0;
+	spatialIndexVersion = -1;
+	eventBudget = 256;
+	eventsProcessed = 0;
+	eventsDropped = 0;
+	simulationRate = 0;
+	simulationCatchUp = 5;
+	simulationSteps = 0;
+	simulationStepsDropped = 0;
+	simulationAlpha = 0;
+	wakeupsPerSecond = 0;
+	layoutRecomputed = 0;
+	layoutInvalidated = 0;
+	layoutRecomputedFrame = 0;
+	layoutInvalidatedFrame = 0;
+	measureHits = 0;
+	measureMisses = 0;
+	measureEpoch = 0;
+	isPhaseOverlay = false;
+	phaseReset();
 }
 
 Context::~Context() {
-//	for (auto log : logs)
-//		delete log
 	SWFLOG(this, LOG_WARN, nullptr);
+	logger.flush();
 }
 
 
@@ -59,34 +87,49 @@ Context::~Context() {
  */
 
  void Context::drawComponents() {
-	Component::traverseInclusive((Component*) rootContainer, Context::onDrawComponent, frontendOut);
-
-	if (frontendOut != nullptr) {
-		const std::pair<int,int> fontDimension = frontendOut->fontDimension();
-		const std::pair<int,int> screenDimension = frontendOut->screenDimension();
+	SWF_ZONE("Context::drawComponents");
+	FrontendOut *out = frontendOut.load();
+	if (out == nullptr) {
+		std::printf("%s drawComponents() no frontend\n", LOG_FACILITY.c_str());
+	} else if (rootContainer != nullptr) {
+		Component::layout((Component*) rootContainer);
+		// a stale store draws through the tree until it is rebuilt, viewports clip and
+		// shift their contents, which only the tree does
+		const bool isStore = componentStore != nullptr && !componentStore->isStale() &&
+		    !componentStore->hasViewport();
+		if (isStore && layoutRecomputed > 0)
+			componentStore->update();
+		if (isStore && !componentStore->isStale())
+			componentStore->draw(out);
+		else
+			Component::draw((Component*) rootContainer, out);
+	}
+	layoutRecomputedFrame = layoutRecomputed;
+	layoutInvalidatedFrame = layoutInvalidated;
+	layoutRecomputed = 0;
+	layoutInvalidated = 0;
+
+	if (out != nullptr) {
+		const std::pair<int,int> fontDimension = out->fontDimension();
+		const std::pair<int,int> screenDimension = out->screenDimension();
 		// draw log
-		if (logs.size() > 0) {
-//			const std::pair<int,int> logDimension { screenDimension.first / 2 - 2 * fontDimension.first,
-//			    fontDimension.second };
-//			std::pair<int,int> logOffset;
+		const int logLines = logger.overlayLines();
+		if (logLines > 0) {
 			// 1 char left padding to screen
 			const int x = 1 * fontDimension.first;
 			// 1 char bottom padding to screen
-			const int y = screenDimension.second - (1 + logs.size()) * fontDimension.second;
-			Position pos {x, y, screenDimension.first / 2 - 2 * fontDimension.first, fontDimension.second, x, y};
-			Style stl {0, 0};
-			for (const auto log : logs) {
-				//display->draw(logOffset, logDimension, *log);
-				frontendOut->draw(pos, stl, *log);
-				pos.y += fontDimension.second;
-				pos.textY = pos.y;
-			}
+			const int y = screenDimension.second - (1 + logLines) * fontDimension.second;
+			LogOverlay overlay { out, {x, y, screenDimension.first / 2 - 2 * fontDimension.first,
+			    fontDimension.second, x, y}, fontDimension.second };
+			logger.overlayTraverse(Context::onDrawLog, &overlay);
 		}
-		// draw fps stats
-		const std::pair<int,int> frameStat = getFpsStat();
-		if (frameStat.first > 0 && frameStat.second > 0) {
+		// draw fps stats, frame time percentiles in millis
+		const HistogramStat frameStat = getFrameStat();
+		if (frameStat.count > 0 && frameStat.p50 > 0) {
 			char buf[100];
-			std::snprintf(buf, 100, "%7dcycl %3dms %3dfps", frameStat.second, frameStat.first, 1000 / frameStat.first);
+			std::snprintf(buf, 100, "%5dlay %5dwk/s %5dcycl p50 %5.1f p90 %5.1f p99 %5.1f max %5.1fms %3dfps",
+			    layoutRecomputedFrame, wakeupsPerSecond, fpsCyclesPerFrame, frameStat.p50 / 1e6, frameStat.p90 / 1e6,
+			    frameStat.p99 / 1e6, frameStat.max / 1e6, (int) (1000000000LL / frameStat.p50));
 			const int w = std::strlen(buf) * fontDimension.first;
 			const int x = screenDimension.first - w - fontDimension.first;
 			const int y = screenDimension.second - 2 * fontDimension.second;
@@ -94,19 +137,245 @@ Context::~Context() {
 	//		display->draw(statOffset, statDimension, buf);
 			const Position pos {x, y, w, fontDimension.second, x, y};
 			Style stl {0, 0};
-			frontendOut->draw(pos, stl, buf);
+			out->draw(pos, stl, buf);
 		}
+		if (isPhaseOverlay)
+			drawPhaseOverlay(fontDimension, screenDimension);
+	}
+}
+
+// one line per phase above the fps stats, percentiles in millis
+void Context::drawPhaseOverlay(const std::pair<int,int> &fontDimension, const std::pair<int,int> &screenDimension) {
+	static const char *phaseNames[PHASE_COUNT] { "event", "render", "draw", "components", "present" };
+	const FrontendOut *out = frontendOut.load();
+	char buf[100];
+	Style stl {0, 0};
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		const HistogramStat stat = phaseHistograms[i].stat();
+		std::snprintf(buf, 100, "%-10s p50 %6.2f p90 %6.2f p99 %6.2f max %6.2fms", phaseNames[i],
+		    stat.p50 / 1e6, stat.p90 / 1e6, stat.p99 / 1e6, stat.max / 1e6);
+		const int w = std::strlen(buf) * fontDimension.first;
+		const int x = screenDimension.first - w - fontDimension.first;
+		const int y = screenDimension.second - (2 + PHASE_COUNT - i) * fontDimension.second;
+		const Position pos {x, y, w, fontDimension.second, x, y};
+		out->draw(pos, stl, buf);
+	}
+}
+
+void Context::onDrawLog(const std::basic_string<char> &line, const int index, void *userData) {
+	LogOverlay *overlay = (LogOverlay*) userData;
+	Position pos = overlay->position;
+	pos.y += index * overlay->lineHeight;
+	pos.textY = pos.y;
+	const Style stl {0, 0};
+	overlay->out->draw(pos, stl, line);
+}
+
+
+/*
+ * component pools
+ */
+
+// pools are created on first use, one per object size, so types of equal size share one
+Pool* Context::getPool(const std::size_t size) {
+	std::unique_ptr<Pool> &p = pools[size];
+	if (p == nullptr)
+		p.reset(new Pool(size, poolSlabSlots));
+	return p.get();
+}
+
+
+/*
+ * hit testing
+ */
+
+// lays out pending changes and rebuilds the index when the layout changed since the
+// last build, clicks are rare compared to frames so the index is not kept up per frame
+void Context::spatialIndexUpdate() {
+	SWF_ZONE("Context::spatialIndexUpdate");
+	FrontendOut *out = frontendOut.load();
+	if (out == nullptr || rootContainer == nullptr) {
+		spatialIndex.clear();
+		return;
 	}
+	Component::layout((Component*) rootContainer);
+	if (spatialIndexVersion == layoutVersion)
+		return;
+	const int count = spatialIndex.build((Component*) rootContainer, out->screenDimension());
+	spatialIndexVersion = layoutVersion;
+	SWFLOG(this, LOG_DEBUG, "%d components", count);
 }
 
-TraverseCondition Context::onDrawComponent(Component *c, void *userData) {
-	FrontendOut *out = (FrontendOut*) userData;
+
+/*
+ * event batching
+ */
+
+// handles all pending events, events beyond the budget are polled and discarded
+// so that input never lags behind more than one frame
+int Context::eventDrain(int (*onEvent)(void*, void*), void *userData) {
+	SWF_ZONE("Context::eventDrain");
+	FrontendIn *in = frontendIn.load();
+	eventsProcessed = 0;
+	eventsDropped = 0;
+	for (;;) {
+		void *e = in->eventPoll();
+		if (e == nullptr)
+			return 0;
+		if (eventBudget > 0 && eventsProcessed >= eventBudget) {
+			eventsDropped++;
+			in->eventFree(e);
+			continue;
+		}
+		eventsProcessed++;
+		const int exitCode = onEvent(e, userData);
+		if (!exitCode)
+			in->in(e);
+		in->eventFree(e);
+		if (exitCode)
+			return exitCode;
+	}
+}
+
+
+/*
+ * threading
+ */
+
+// runs the queued tasks outside of the lock, so tasks may invoke further tasks
+void Context::taskDrain() {
+	{
+		std::lock_guard<std::mutex> lock { taskMutex };
+		if (tasks.empty())
+			return;
+		tasks.swap(tasksRunning);
+	}
+	for (const auto &task : tasksRunning)
+		task.first(task.second);
+	tasksRunning.clear();
+}
+
+
+/*
+ * fixed timestep simulation
+ */
+
+// runs as many simulation ticks as fit into the elapsed time, limited by the catch up
+// count so that a slow frame cannot spiral into ever more simulation work
+void Context::simulationAdvance(const long long nanos, void (*onSimulate)(void*), void *userData) {
+	SWF_ZONE("Context::simulationAdvance");
+	if (simulationNanosPrevious == 0)
+		simulationNanosPrevious = nanos;
+	simulationAccumulator += (nanos - simulationNanosPrevious) * simulationRate;
+	simulationNanosPrevious = nanos;
+	simulationSteps = 0;
+	simulationStepsDropped = 0;
+	while (simulationAccumulator >= nanosPerSecond) {
+		if (simulationSteps >= simulationCatchUp) {
+			simulationStepsDropped = (int) (simulationAccumulator / nanosPerSecond);
+			simulationAccumulator %= nanosPerSecond;
+			break;
+		}
+		onSimulate(userData);
+		simulationAccumulator -= nanosPerSecond;
+		simulationSteps++;
+	}
+	simulationAlpha = (float) ((double) simulationAccumulator / nanosPerSecond);
+}
+
+
+/*
+ * loop
+ */
+
+// variable mode (simulation rate 0) renders once per cycle or once per frame when sleepy,
+// fixed mode simulates at the given rate and hands the interpolation factor to onDraw
+int Context::loop(const int targetFps, const bool isSleepy, const int rate, int (*onEvent)(void*, void*),
+	    void (*onRender)(void*), void (*onDraw)(void*), void (*onDrawInterpolated)(const float, void*),
+	    void *userData) {
+	SWFLOG(this, LOG_INFO, "enter loop");
+
+	FrontendIn *in = frontendIn.load();
+	const FrontendOut *out = frontendOut.load();
+	if (in == nullptr) {
+		SWFLOG(this, LOG_WARN, "no IN-frontend defined");
+		return -1;
+	}
 	if (out == nullptr) {
-		std::printf("%s onDraw() no frontend\n", LOG_FACILITY.c_str());
-		return TraverseCondition::notMatchBreak;
+		SWFLOG(this, LOG_WARN, "no OUT-frontend defined");
+		return -1;
+	}
+
+	fpsNanosPrevious = 0;
+	fpsNanosStart = 0;
+	fpsFrameIndex = 0;
+	fpsDeadline = 0;
+	fpsFrameNanos = 0;
+	fpsCyclesPerFrame = 0;
+	fpsCyclesPerFrameCounter = 0;
+	fpsHistogram.reset();
+
+	wakeupNanosPrevious = 0;
+	wakeupCounter = 0;
+	wakeupsPerSecond = 0;
+
+	simulationRate = rate;
+	simulationNanosPrevious = 0;
+	simulationAccumulator = 0;
+	simulationSteps = 0;
+	simulationStepsDropped = 0;
+	simulationAlpha = 0;
+
+	phaseReset();
+
+	for (;;) {
+		SWF_ZONE("Context::loop");
+		// deadlines follow the loop clock, durations are measured in real time
+		const long long nanos = in->gameLoopNanos();
+		long long phaseStart = in->measureNanos();
+		wakeupCount(phaseStart);
+		const bool isElapsed = fpsIsNanosElapsed(nanos);
+		if (isElapsed) {
+			fpsResetNanos(nanos, phaseStart, targetFps);
+			taskDrain();
+			const int exitCode = eventDrain(onEvent, userData);
+			if (exitCode)
+				return exitCode;
+			phaseStart = phaseAdd(PHASE_EVENT, phaseStart);
+		}
+		if (simulationRate > 0) {
+			if (isElapsed) {
+				simulationAdvance(nanos, onRender, userData);
+				phaseStart = phaseAdd(PHASE_RENDER, phaseStart);
+			}
+		} else if (isElapsed || !isSleepy) {
+			SWF_ZONE("onRender");
+			onRender(userData);
+			phaseStart = phaseAdd(PHASE_RENDER, phaseStart);
+		}
+		if (isElapsed) {
+			{
+				SWF_ZONE("onDraw");
+				if (onDrawInterpolated != nullptr)
+					onDrawInterpolated(simulationAlpha, userData);
+				else
+					onDraw(userData);
+			}
+			phaseStart = phaseAdd(PHASE_DRAW, phaseStart);
+			drawComponents();
+			phaseStart = phaseAdd(PHASE_COMPONENTS, phaseStart);
+			{
+				SWF_ZONE("FrontendOut::gameLoopDrawFinish");
+				out->gameLoopDrawFinish();
+			}
+			phaseAdd(PHASE_PRESENT, phaseStart);
+			phaseCommit();
+		}
+		if (!isElapsed && isSleepy) {
+			SWF_ZONE("FrontendIn::gameLoopSleepUntil");
+			in->gameLoopSleepUntil(fpsDeadline);
+		}
 	}
-	c->onDraw(out);
-	return TraverseCondition::notMatch;
 }
 
 
@@ -114,20 +383,72 @@ TraverseCondition Context::onDrawComponent(Component *c, void *userData) {
  * fps statistics
  */
 
-bool Context::fpsIsTicksElapsed(const long ticksCurrent, const long targetFps) {
+bool Context::fpsIsNanosElapsed(const long long nanosCurrent) {
 	fpsCyclesPerFrameCounter++;
-	// over 2/3 of target millis is elapsed
-	if (ticksCurrent - fpsTicksPrevious > 2000 / (3 * targetFps))
-		return true;
-	return false;
+	return nanosCurrent >= fpsDeadline;
 }
 
-void Context::fpsResetTicks(const long ticksCurrent) {
-	if (fpsTicksPrevious)
-		fpsFrameMillis = (int) (ticksCurrent - fpsTicksPrevious);
-	fpsTicksPrevious = ticksCurrent;
+// deadlines are computed from the frame index, so rounding does not accumulate;
+// start over when more than a frame behind
+void Context::fpsResetNanos(const long long nanosCurrent, const long long measureCurrent, const long targetFps) {
+	if (fpsNanosPrevious) {
+		fpsFrameNanos = measureCurrent - fpsNanosPrevious;
+		fpsHistogram.record(fpsFrameNanos);
+	}
+	fpsNanosPrevious = measureCurrent;
 	fpsCyclesPerFrame = fpsCyclesPerFrameCounter;
 	fpsCyclesPerFrameCounter = 0;
+	fpsFrameIndex++;
+	fpsDeadline = fpsNanosStart + fpsFrameIndex * nanosPerSecond / targetFps;
+	if (fpsDeadline <= nanosCurrent) {
+		fpsNanosStart = nanosCurrent;
+		fpsFrameIndex = 1;
+		fpsDeadline = fpsNanosStart + nanosPerSecond / targetFps;
+	}
+}
+
+
+/*
+ * phase statistics
+ */
+
+// adds the time since start to the phase of the current frame, returns the current nanos
+// to be used as start of the following phase
+long long Context::phaseAdd(const int phase, const long long start) {
+	const long long nanos = frontendIn.load()->measureNanos();
+	phaseNanosCounter[phase] += nanos - start;
+	return nanos;
+}
+
+void Context::phaseReset() {
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		phaseHistograms[i].reset();
+		phaseNanos[i] = 0;
+		phaseNanosCounter[i] = 0;
+	}
+}
+
+void Context::phaseCommit() {
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		phaseNanos[i] = phaseNanosCounter[i];
+		phaseHistograms[i].record(phaseNanosCounter[i]);
+		phaseNanosCounter[i] = 0;
+	}
+}
+
+
+/*
+ * wakeup statistics
+ */
+
+void Context::wakeupCount(const long long nanosCurrent) {
+	wakeupCounter++;
+	if (nanosCurrent - wakeupNanosPrevious < nanosPerSecond)
+		return;
+	if (wakeupNanosPrevious)
+		wakeupsPerSecond = (int) (wakeupCounter * nanosPerSecond / (nanosCurrent - wakeupNanosPrevious));
+	wakeupNanosPrevious = nanosCurrent;
+	wakeupCounter = 0;
 }
 
 
@@ -140,14 +461,84 @@ void Context::fpsResetTicks(const long ticksCurrent) {
  * getter / setter
  */
 
+// events processed and dropped in the previous frame
+std::pair<int,int> Context::getEventStat() const {
+	return { eventsProcessed, eventsDropped };
+}
+
+void Context::setEventBudget(const int budget) {
+	if (budget < 0) {
+		SWFLOG(this, LOG_WARN, "negative budget %d", budget);
+		return;
+	}
+	eventBudget = budget;
+}
+
+// duration of the previous frame in millis and loop cycles it took
 std::pair<int,int> Context::getFpsStat() const {
-	return { fpsFrameMillis, fpsCyclesPerFrame };
+	return { (int) (fpsFrameNanos / 1000 / 1000), fpsCyclesPerFrame };
+}
+
+// frame duration percentiles in nanos over the recent frames
+HistogramStat Context::getFrameStat() const {
+	return fpsHistogram.stat();
+}
+
+// simulation ticks run and dropped in the previous frame
+std::pair<int,int> Context::getSimulationStat() const {
+	return { simulationSteps, simulationStepsDropped };
+}
+
+float Context::getSimulationAlpha() const {
+	return simulationAlpha;
+}
+
+void Context::setSimulationCatchUp(const int ticks) {
+	if (ticks < 1) {
+		SWFLOG(this, LOG_WARN, "catch up must be at least 1, got %d", ticks);
+		return;
+	}
+	simulationCatchUp = ticks;
+}
+
+// phase duration percentiles in nanos over the recent frames
+HistogramStat Context::getPhaseStat(const FramePhase phase) const {
+	if (phase < 0 || phase >= PHASE_COUNT)
+		return { 0, 0, 0, 0, 0 };
+	return phaseHistograms[phase].stat();
+}
+
+// phase duration of the previous frame in nanos
+long long Context::getPhaseNanos(const FramePhase phase) const {
+	if (phase < 0 || phase >= PHASE_COUNT)
+		return 0;
+	return phaseNanos[phase];
+}
+
+void Context::setPhaseOverlay(const bool isOverlay) {
+	isPhaseOverlay = isOverlay;
+}
+
+// loop wakeups per second, a sleepy loop wakes about once per frame
+int Context::getWakeupStat() const {
+	return wakeupsPerSecond;
+}
+
+// components laid out and marked dirty in the previous frame
+std::pair<int,int> Context::getLayoutStat() const {
+	return { layoutRecomputedFrame, layoutInvalidatedFrame };
+}
+
+// measures answered from the caches and computed, since the start
+std::pair<long,long> Context::getMeasureStat() const {
+	return { measureHits, measureMisses };
 }
 
 const FrontendIn* Context::getFrontendIn() {
-	if (frontendIn == nullptr)
+	const FrontendIn *in = frontendIn.load();
+	if (in == nullptr)
 		SWFLOG(this, LOG_WARN, "no frontendIn");
-	return frontendIn;
+	return in;
 }
 
 void Context::setFrontendIn(FrontendIn *in) {
@@ -155,14 +546,16 @@ void Context::setFrontendIn(FrontendIn *in) {
 }
 
 const FrontendOut* Context::getFrontendOut() {
-	if (frontendOut == nullptr)
+	const FrontendOut *out = frontendOut.load();
+	if (out == nullptr)
 		SWFLOG(this, LOG_WARN, "no frontendOut");
-	return frontendOut;
+	return out;
 }
 
 void Context::setFrontendOut(FrontendOut *out) {
 	frontendOut = out;
-	rootContainer->invalidatePosition();
+	if (rootContainer != nullptr)
+		((Component*) rootContainer)->invalidateSize();
 }
 
 const Container* Context::getRootContainer() {
@@ -173,6 +566,89 @@ const Container* Context::getRootContainer() {
 
 void Context::setRootContainer(Container *rc) {
 	rootContainer = rc;
+	contentsChanged();
+}
+
+// draws from the store instead of traversing the tree, the store is owned and rebuilt
+// by the caller, while stale the tree is drawn, nullptr switches back to the traversal
+void Context::setComponentStore(ComponentStore *store) {
+	componentStore = store;
+}
+
+
+/*
+ * layout
+ */
+
+// components report recomputed and invalidated positions
+void Context::layoutCount(const int recomputed, const int invalidated) {
+	layoutRecomputed += recomputed;
+	layoutInvalidated += invalidated;
+	if (recomputed != 0 || invalidated != 0)
+		layoutVersion++;
+}
+
+void Context::measureCount(const bool hit) {
+	if (hit)
+		measureHits++;
+	else
+		measureMisses++;
+}
+
+int Context::getMeasureEpoch() const {
+	return measureEpoch;
+}
+
+// every cached measure is stale, the frontends call this when the font changes
+void Context::measureInvalidate() {
+	measureEpoch++;
+}
+
+
+/*
+ * component lifecycle
+ */
+
+// components were attached or detached or a viewport scrolled, views of the tree built
+// from the layout are stale
+void Context::contentsChanged() {
+	layoutVersion++;
+	if (componentStore != nullptr)
+		componentStore->markStale();
+}
+
+// a component draws another text object than before, the store holds the old one
+void Context::textReplaced() {
+	if (componentStore != nullptr)
+		componentStore->markStale();
+}
+
+// components alive in the pools and slabs allocated
+std::pair<long,int> Context::getPoolStat() const {
+	long inUse = 0;
+	int slabs = 0;
+	for (auto &p : pools) {
+		inUse += p.second->getInUse();
+		slabs += p.second->getSlabCount();
+	}
+	return { inUse, slabs };
+}
+
+
+/*
+ * hit testing
+ */
+
+// deepest component under the point, the one drawn last
+Component* Context::findComponentAt(const int x, const int y) {
+	spatialIndexUpdate();
+	return spatialIndex.find(x, y);
+}
+
+// appends the components intersecting the rect, returns the number found
+int Context::findComponentsIn(const Position &rect, std::vector<Component*> *found) {
+	spatialIndexUpdate();
+	return spatialIndex.find(rect, found);
 }
 
 
@@ -180,78 +656,105 @@ void Context::setRootContainer(Container *rc) {
  * event
  */
 
-void Context::eventClick(const int, const int) {
+// the deepest component under the pointer gets the click first, then its ancestors
+void Context::eventClick(const int x, const int y) {
+	Component *c = findComponentAt(x, y);
+	SWFLOG(this, LOG_DEBUG, "%dx%d %s", x, y, c == nullptr ? "miss" : "hit");
+	if (c != nullptr)
+		c->eventClick(x, y);
 }
 
 void Context::eventKey(const int) {
 }
 
 
+/*
+ * threading
+ */
+
+// queues a callback to run on the loop thread before the next frame, safe to call
+// from any thread
+void Context::invoke(void (*cb)(void*), void *userData) {
+	{
+		std::lock_guard<std::mutex> lock { taskMutex };
+		tasks.emplace_back(cb, userData);
+	}
+	FrontendIn *in = frontendIn.load();
+	if (in != nullptr)
+		in->eventWakeup();
+}
+
+
 /*
  * loop
  */
 
 int Context::gameLoop(const int targetFps, const bool isSleepy, int (*onEvent)(void*, void*),
 	   void (*onRender)(void*), void (*onDraw)(void*), void* userData) {
-	SWFLOG(this, LOG_INFO, "enter loop");
+	return loop(targetFps, isSleepy, 0, onEvent, onRender, onDraw, nullptr, userData);
+}
 
-	if (frontendIn == nullptr) {
-		SWFLOG(this, LOG_WARN, "no IN-frontend defined");
+// simulation ticks at a fixed rate independent of the frame rate, always sleepy
+int Context::simulationLoop(const int targetFps, const int rate, int (*onEvent)(void*, void*),
+	   void (*onSimulate)(void*), void (*onDraw)(const float, void*), void* userData) {
+	if (rate < 1) {
+		SWFLOG(this, LOG_WARN, "invalid simulation rate %d", rate);
 		return -1;
 	}
-	if (frontendOut == nullptr) {
-		SWFLOG(this, LOG_WARN, "no OUT-frontend defined");
+	return loop(targetFps, true, rate, onEvent, onSimulate, nullptr, onDraw, userData);
+}
+
+// blocks until there is input, a wakeup or timer expiry, and draws only then;
+// returns LOOP_EVENT_END once the input has no more events
+int Context::applicationLoop(int (*onEvent)(const bool, void*, void*), void* userData) {
+	FrontendIn *in = frontendIn.load();
+	const FrontendOut *out = frontendOut.load();
+	if (in == nullptr || out == nullptr) {
+		SWFLOG(this, LOG_WARN, "no frontend defined");
 		return -1;
 	}
-
-	fpsTicksPrevious = 0;
-	fpsFrameMillis = 0;
-	fpsCyclesPerFrame = 0;
-
+	phaseReset();
+	void *e;
 	for (;;) {
-		const long ticks = frontendIn->gameLoopTicks();
-		const bool isElapsed = fpsIsTicksElapsed(ticks, targetFps);
-		if (isElapsed) {
-			fpsResetTicks(ticks);
-			void *e = frontendIn->eventPoll();
+		e = in->eventWait();
+		if (e == nullptr && in->isEventEnd())
+			return LOOP_EVENT_END;
+		long long phaseStart = in->measureNanos();
+		taskDrain();
+		if (e != nullptr) {
 			int exitCode = 0;
-			if (e != nullptr) {
-				exitCode = onEvent(e, userData);
-				if (!exitCode)
-					frontendIn->in(e);
+			exitCode = onEvent(false, e, userData);
+			if (!exitCode) {
+				in->in(e);
+				exitCode = onEvent(true, e, userData);
 			}
-			frontendIn->eventFree(e);
+			in->eventFree(e);
 			if (exitCode)
 				return exitCode;
+			phaseStart = phaseAdd(PHASE_EVENT, phaseStart);
 		}
-		if (isElapsed || !isSleepy)
-			onRender(userData);
-		if (isElapsed) {
-			onDraw(userData);
-			drawComponents();
-			frontendOut->gameLoopDrawFinish();
-		}
-		if (!isElapsed && isSleepy) 
-			frontendIn->gameLoopSleep();
+		drawComponents();
+		phaseStart = phaseAdd(PHASE_COMPONENTS, phaseStart);
+		out->gameLoopDrawFinish();
+		phaseAdd(PHASE_PRESENT, phaseStart);
+		phaseCommit();
 	}
 }
 
-int Context::applicationLoop(int (*onEvent)(const bool, void*, void*), void* userData) {
-	void *e;
-	for (;;) {
-		e = frontendIn->eventWait();
-		if (e == nullptr)
-			continue;
-		int exitCode = 0;
-		exitCode = onEvent(false, e, userData);
-		if (!exitCode) {
-			frontendIn->in(e);
-			exitCode = onEvent(true, e, userData);
-		}
-		if (exitCode)
-			return exitCode;
-		drawComponents();
-	}
+
+/*
+ * profiling
+ */
+
+// writes the SWF_ZONE records of all threads as chrome trace event json
+bool Context::profileDump(const char *path) {
+#ifdef SWF_PROFILE
+	SWFLOG(this, LOG_INFO, "dump to %s", path);
+	return Profile::dump(path);
+#else
+	SWFLOG(this, LOG_WARN, "profiling not compiled in, build with -DSWF_PROFILE");
+	return false;
+#endif
 }
 
 
@@ -259,41 +762,42 @@ int Context::applicationLoop(int (*onEvent)(const bool, void*, void*), void* use
  * logging
  */
 
-const static std::size_t bufSize = 1000;
-static char buf[bufSize];
+void Context::log(const int level, const std::basic_string<char> &facility, const char *functionName, const char *format...) {
+	// print if there is no frontend to show the overlay, alert only without one
+	const bool isOut = frontendOut.load(std::memory_order_relaxed) != nullptr;
+	const bool isPrint = !isOut || level == Context::LOG_WARN;
+	const bool isAlert = !isOut && level == Context::LOG_WARN;
+	va_list arg;
+	va_start(arg, format);
+	logger.log(level, facility, functionName, isPrint, isAlert, format, arg);
+	va_end(arg);
+}
 
-void Context::log(const int level, const std::basic_string<char> &facility, const std::basic_string<char> &functionName, const char *format...) {
+bool Context::isLogFacilityEnabled(const std::map<std::basic_string<char>,int> *levels, const int level,
+    const std::basic_string<char> &facility) const {
+	const auto it = levels->find(facility);
+	return level >= (it != levels->end() ? it->second : logLevel.load(std::memory_order_relaxed));
+}
 
-	std::basic_string<char> *s;
-	if (logs.size() > 20) {
-		s = logs.front();
-		s->clear();
-		logs.pop_front();
-	} else {
-		s = new std::basic_string<char>();
-	}
+void Context::setLogLevel(const int level) {
+	logLevel = level;
+}
 
-	std::snprintf(buf, bufSize, "%d", level);
-	s->append(buf);
-	std::snprintf(buf, bufSize, " %-16.16s", facility.c_str());
-	s->append(buf);
-	std::snprintf(buf, bufSize, " %-24.24s", functionName.c_str());
-	s->append(buf);
-
-	if (format != nullptr) {
-		va_list arg;
-		va_start(arg, format);
-		std::vsnprintf(buf, bufSize, format, arg);
-		s->append(buf);
-		va_end(arg);
-	}
+// overrides the global level for one facility, publishes a changed copy of the overrides
+void Context::setLogLevel(const std::basic_string<char> &facility, const int level) {
+	std::lock_guard<std::mutex> lock { logFacilityMutex };
+	const std::map<std::basic_string<char>,int> *levels = logFacilityLevels.load(std::memory_order_relaxed);
+	std::unique_ptr<std::map<std::basic_string<char>,int>> changed { levels != nullptr ?
+	    new std::map<std::basic_string<char>,int>(*levels) : new std::map<std::basic_string<char>,int>() };
+	(*changed)[facility] = level;
+	logFacilitySnapshots.push_back(std::move(changed));
+	logFacilityLevels.store(logFacilitySnapshots.back().get(), std::memory_order_release);
+}
 
-	logs.push_back(s);
+void Context::logFlush() {
+	logger.flush();
+}
 
-	if (frontendOut == nullptr || level == Context::LOG_WARN)
-		std::printf("%s\n", s->c_str());
-#ifdef _WINDOWS
-	if (frontendOut == nullptr && level == Context::LOG_WARN)
-		GdiOut::messageBox(0, s->c_str());
-#endif
+long Context::getLogDropped() const {
+	return logger.getDropped();
 }
@@ -17,18 +17,37 @@
 #ifndef SWF_CORE_CONTEXT
 #define SWF_CORE_CONTEXT
 
-#include <deque>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Component.hpp"
+#include "Histogram.hpp"
+#include "Logger.hpp"
+#include "Pool.hpp"
+#include "SpatialIndex.hpp"
 
 //class Component;
+class ComponentStore;
 class Container;
 class FrontendIn;
 class FrontendOut;
 
-#define SWFLOG(X, Y, FMT, ...) (X)->log(Context::Y, LOG_FACILITY, __func__, FMT, ##__VA_ARGS__)
+// levels below SWF_LOG_LEVEL_MIN are compiled out, e.g. -DSWF_LOG_LEVEL_MIN=1 drops LOG_DEBUG;
+// disabled messages never evaluate their arguments
+#ifndef SWF_LOG_LEVEL_MIN
+#define SWF_LOG_LEVEL_MIN 0
+#endif
+
+#define SWFLOG(X, Y, FMT, ...) do { \
+	if (Context::Y >= SWF_LOG_LEVEL_MIN && (X)->isLogEnabled(Context::Y, LOG_FACILITY)) \
+		(X)->log(Context::Y, LOG_FACILITY, __func__, FMT, ##__VA_ARGS__); \
+	} while (0)
 
 //enum LogLevel { LOG_DEBUG, LOG_INFO, LOG_WARN };
 
@@ -123,52 +142,195 @@ Site::~Site() {
 }
 */
 
+// a context is driven by the thread running its loop, other threads hand work over
+// with invoke(); several contexts may run in parallel, each on its own thread
 class Context {
 
 private:
-	FrontendIn *frontendIn;
-	FrontendOut *frontendOut;
+	std::atomic<FrontendIn*> frontendIn;
+	std::atomic<FrontendOut*> frontendOut;
 	Container *rootContainer;
+	ComponentStore *componentStore;	// optional flat copy of the tree for drawing
+
+	// hit testing
+	SpatialIndex spatialIndex;
+	long long layoutVersion;		// counts layout changes
+	long long spatialIndexVersion;		// layout version the index was built from
+	void spatialIndexUpdate();
+
+	// component pools by object size
+	std::map<std::size_t, std::unique_ptr<Pool>> pools;
+	Pool* getPool(const std::size_t);
+
+	// tasks from other threads, run by the loop thread
+	std::mutex taskMutex;
+	std::vector<std::pair<void (*)(void*), void*>> tasks;
+	std::vector<std::pair<void (*)(void*), void*>> tasksRunning;
+	void taskDrain();
 
-	std::deque<std::basic_string<char>*> logs;
+	// logging
+	Logger logger;
+	std::atomic<int> logLevel;	// global runtime minimum level
+	// overrides per facility, an immutable snapshot replaced on every change, nullptr
+	// without overrides, snapshots live as long as the context so readers need no lock
+	std::atomic<const std::map<std::basic_string<char>,int>*> logFacilityLevels;
+	std::mutex logFacilityMutex;	// serializes writers
+	std::vector<std::unique_ptr<const std::map<std::basic_string<char>,int>>> logFacilitySnapshots;
+	bool isLogFacilityEnabled(const std::map<std::basic_string<char>,int>*, const int,
+	    const std::basic_string<char>&) const;
+	struct LogOverlay {
+		FrontendOut *out;
+		Position position;
+		int lineHeight;
+	};
+	static void onDrawLog(const std::basic_string<char>&, const int, void*);
+
+	// event batching
+	int eventBudget;		// max events handled per frame, 0 is unlimited
+	int eventsProcessed;		// events handled in the previous frame
+	int eventsDropped;		// events discarded in the previous frame
+	int eventDrain(int (*)(void*, void*), void*);
 
 	// drawing
 	void drawComponents();
-	static TraverseCondition onDrawComponent(Component*, void*);
+
+	// fixed timestep simulation
+	int simulationRate;		// simulation ticks per second
+	int simulationCatchUp;		// max simulation ticks per frame
+	long long simulationNanosPrevious;
+	long long simulationAccumulator;	// elapsed nanos times rate, one tick per second
+	int simulationSteps;		// simulation ticks in the previous frame
+	int simulationStepsDropped;	// simulation ticks skipped in the previous frame
+	float simulationAlpha;		// interpolation factor between two simulation ticks
+	void simulationAdvance(const long long, void (*)(void*), void*);
+
+	// loop
+	int loop(const int, const bool, const int, int (*)(void*, void*), void (*)(void*), void (*)(void*),
+	    void (*)(const float, void*), void*);
 
 	// fps statistics
-	long fpsTicksPrevious;	// need to remember for elapsed ticks calculation
+	long long fpsNanosPrevious;	// measure nanos of the previous frame, for its duration
+	long long fpsNanosStart;	// frame deadlines are relative to this
+	long long fpsFrameIndex;	// frames since fpsNanosStart
+	long long fpsDeadline;	// nanos when the next frame is due
 	int fpsCyclesPerFrame;	// number of event loop cycles per frame
 	int fpsCyclesPerFrameCounter;
-	int fpsFrameMillis;	// duration of a frame
-	bool fpsIsTicksElapsed(const long, const long);
-	void fpsResetTicks(const long);
+	long long fpsFrameNanos;	// duration of a frame
+	Histogram fpsHistogram;		// frame durations of the recent frames
+	bool fpsIsNanosElapsed(const long long);
+	void fpsResetNanos(const long long, const long long, const long);
+
+	// phase statistics
+	std::vector<Histogram> phaseHistograms;
+	std::vector<long long> phaseNanos;		// phase durations of the previous frame
+	std::vector<long long> phaseNanosCounter;	// phase durations of the current frame
+	bool isPhaseOverlay;
+	long long phaseAdd(const int, const long long);
+	void phaseReset();
+	void phaseCommit();
+	void drawPhaseOverlay(const std::pair<int,int>&, const std::pair<int,int>&);
+
+	// wakeup statistics
+	long long wakeupNanosPrevious;
+	int wakeupCounter;
+	int wakeupsPerSecond;	// loop cycles in the previous second
+	void wakeupCount(const long long);
+
+	// layout statistics
+	int layoutRecomputed;		// components laid out in the current frame
+	int layoutInvalidated;		// components marked dirty in the current frame
+	int layoutRecomputedFrame;	// of the previous frame
+	int layoutInvalidatedFrame;
+
+	// measure statistics
+	long measureHits;
+	long measureMisses;
+	int measureEpoch;		// bumped when every measure is stale, like on a font change
 
 public:
 	enum LogLevel { LOG_DEBUG, LOG_INFO, LOG_WARN };
+	enum FramePhase { PHASE_EVENT, PHASE_RENDER, PHASE_DRAW, PHASE_COMPONENTS, PHASE_PRESENT, PHASE_COUNT };
+	enum LoopExit { LOOP_EVENT_END = -2 };	// returned by applicationLoop when the input has ended
 
 	Context();
 	~Context();
 
 	// getter / setter
+	std::pair<int,int> getEventStat() const;
+	void setEventBudget(const int);
 	std::pair<int,int> getFpsStat() const;
+	HistogramStat getFrameStat() const;
+	HistogramStat getPhaseStat(const FramePhase) const;
+	long long getPhaseNanos(const FramePhase) const;
+	void setPhaseOverlay(const bool);
+	int getWakeupStat() const;
+	std::pair<int,int> getLayoutStat() const;
+	std::pair<long,long> getMeasureStat() const;
+	std::pair<int,int> getSimulationStat() const;
+	float getSimulationAlpha() const;
+	void setSimulationCatchUp(const int);
 	const FrontendIn* getFrontendIn();
 	void setFrontendIn(FrontendIn*);
 	const FrontendOut* getFrontendOut();
 	void setFrontendOut(FrontendOut*);
 	const Container* getRootContainer();
 	void setRootContainer(Container*);
+	void setComponentStore(ComponentStore*);
+
+	// layout
+	void layoutCount(const int, const int);
+	void measureCount(const bool);
+	int getMeasureEpoch() const;
+	void measureInvalidate();
+
+	// component lifecycle
+	template<typename T, typename... A>
+	T* create(Container*, A&&...);
+	void contentsChanged();
+	void textReplaced();
+	std::pair<long,int> getPoolStat() const;
+
+	// hit testing
+	Component* findComponentAt(const int, const int);
+	int findComponentsIn(const Position&, std::vector<Component*>*);
 
 	// event
 	void eventClick(const int, const int);
 	void eventKey(const int);
 
+	// threading
+	void invoke(void (*)(void*), void*);
+
 	// loop
 	int gameLoop(const int, const bool, int (*)(void*, void*), void (*)(void*), void (*)(void*), void*);
+	int simulationLoop(const int, const int, int (*)(void*, void*), void (*)(void*), void (*)(const float, void*), void*);
 	int applicationLoop(int (*)(const bool, void*, void*), void*);
 
+	// profiling
+	bool profileDump(const char*);
+
 	// logging
-	void log(const int, const std::basic_string<char>&, const std::basic_string<char>&, const char*...);
+	void log(const int, const std::basic_string<char>&, const char*, const char*...);
+	// the facility map is only consulted if there are overrides
+	bool isLogEnabled(const int level, const std::basic_string<char> &facility) const {
+		const std::map<std::basic_string<char>,int> *levels = logFacilityLevels.load(std::memory_order_acquire);
+		return levels == nullptr ? level >= logLevel.load(std::memory_order_relaxed) :
+		    isLogFacilityEnabled(levels, level, facility);
+	}
+	void setLogLevel(const int);
+	void setLogLevel(const std::basic_string<char>&, const int);
+	void logFlush();
+	long getLogDropped() const;
 };
 
+// constructs a component in the pool for its size, release it with Component::destroy
+// before the context goes away
+template<typename T, typename... A>
+T* Context::create(Container *parent, A&&... args) {
+	Pool *pool = getPool(sizeof(T));
+	T *c = new (pool->allocate()) T(parent, std::forward<A>(args)...);
+	((Component*) c)->pool = pool;
+	return c;
+}
+
 #endif // SWF_CORE_CONTEXT
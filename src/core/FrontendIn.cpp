@@ -14,6 +14,20 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <cerrno>
+#include <cstdint>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#endif
+#ifndef _WINDOWS
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 #include "FrontendIn.hpp"
 
 //#include "Component.hpp"
@@ -21,6 +35,11 @@
 
 static const std::basic_string<char> LOG_FACILITY = "FRONTEND_IN";
 
+#ifndef _WINDOWS
+// remainder of a sleep that is spent spinning, covers the scheduler wakeup latency
+static const long long sleepSpinNanos = 200 * 1000;
+#endif
+
 
 /*
  * ******************************************************** constructor / destructor
@@ -28,10 +47,39 @@ static const std::basic_string<char> LOG_FACILITY = "FRONTEND_IN";
 
 FrontendIn::FrontendIn(Context &ctx) {
 	context = &ctx;
+	eventPollFd = -1;
+	eventWakeupFd = -1;
+	eventWakeupWriteFd = -1;
+	eventTimerFd = -1;
+	eventTimerMillis = 0;
+	eventTimerDeadline = 0;
+#if defined(__linux__)
+	eventWakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	eventWakeupWriteFd = eventWakeupFd;
+	eventTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+#elif !defined(_WINDOWS)
+	int fds[2];
+	if (pipe(fds) == 0) {
+		fcntl(fds[0], F_SETFL, O_NONBLOCK);
+		fcntl(fds[1], F_SETFL, O_NONBLOCK);
+		eventWakeupFd = fds[0];
+		eventWakeupWriteFd = fds[1];
+	}
+#endif
 	context->setFrontendIn(this);
 }
 
 FrontendIn::~FrontendIn() {
+#ifndef _WINDOWS
+	if (eventPollFd != -1)
+		close(eventPollFd);
+	if (eventWakeupWriteFd != -1 && eventWakeupWriteFd != eventWakeupFd)
+		close(eventWakeupWriteFd);
+	if (eventWakeupFd != -1)
+		close(eventWakeupFd);
+	if (eventTimerFd != -1)
+		close(eventTimerFd);
+#endif
 }
 
 
@@ -49,6 +97,41 @@ void FrontendIn::eventFree(void *event) {
 }
 
 
+/*
+ * event multiplexing
+ */
+
+// the backend descriptor is only known after the subclass is constructed
+bool FrontendIn::eventBlockInit() {
+#ifdef __linux__
+	eventPollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (eventPollFd == -1) {
+		SWFLOG(getContext(), LOG_WARN, "epoll create error %d", errno);
+		return false;
+	}
+	const int fds[] { eventFd(), eventWakeupFd, eventTimerFd };
+	for (const int fd : fds) {
+		if (fd == -1)
+			continue;
+		epoll_event ev {};
+		ev.events = EPOLLIN;
+		ev.data.fd = fd;
+		if (epoll_ctl(eventPollFd, EPOLL_CTL_ADD, fd, &ev) == -1)
+			SWFLOG(getContext(), LOG_WARN, "epoll add fd %d error %d", fd, errno);
+	}
+#endif
+	return true;
+}
+
+void FrontendIn::eventWakeupDrain() const {
+#ifndef _WINDOWS
+	char buf[64];
+	while (read(eventWakeupFd, buf, sizeof(buf)) > 0)
+		;
+#endif
+}
+
+
 /*
  * ******************************************************** public
  */
@@ -64,3 +147,159 @@ Context* FrontendIn::getContext() const {
 	return context;
 }
 
+
+/*
+ * event handling
+ */
+
+// override to make events recordable, the event must be valid when copied back bytewise
+int FrontendIn::eventSize(void *event) const {
+	return 0;
+}
+
+// override to expose a descriptor that becomes readable on input, defaults to none
+int FrontendIn::eventFd() const {
+	return -1;
+}
+
+// blocks until there is work, returns true if the backend descriptor became readable
+// or may have input, false on wakeup or timer expiry
+bool FrontendIn::eventBlock() {
+#if defined(__linux__)
+	if (eventPollFd == -1 && !eventBlockInit()) {
+		gameLoopSleep();
+		return true;
+	}
+	epoll_event evs[3];
+	const int n = epoll_wait(eventPollFd, evs, 3, -1);
+	if (n == -1) {
+		// interrupted, e.g. by SIGWINCH, the backend may have input to report
+		if (errno != EINTR)
+			SWFLOG(getContext(), LOG_WARN, "epoll wait error %d", errno);
+		return true;
+	}
+	bool isInput = false;
+	for (int i = 0; i < n; i++) {
+		const int fd = evs[i].data.fd;
+		if (fd == eventWakeupFd) {
+			eventWakeupDrain();
+		} else if (fd == eventTimerFd) {
+			uint64_t expirations;
+			if (read(eventTimerFd, &expirations, sizeof(expirations)) == -1 && errno != EAGAIN)
+				SWFLOG(getContext(), LOG_WARN, "timerfd read error %d", errno);
+		} else {
+			isInput = true;
+		}
+	}
+	return isInput;
+#elif !defined(_WINDOWS)
+	pollfd fds[2];
+	int n = 0;
+	const int backendFd = eventFd();
+	if (backendFd != -1)
+		fds[n++] = { backendFd, POLLIN, 0 };
+	if (eventWakeupFd != -1)
+		fds[n++] = { eventWakeupFd, POLLIN, 0 };
+	int timeout = -1;
+	if (eventTimerMillis > 0) {
+		timeout = (int) (eventTimerDeadline - gameLoopTicks());
+		if (timeout < 0)
+			timeout = 0;
+	}
+	const int r = poll(fds, n, timeout);
+	if (r == -1) {
+		if (errno != EINTR)
+			SWFLOG(getContext(), LOG_WARN, "poll error %d", errno);
+		return true;
+	}
+	if (eventTimerMillis > 0 && gameLoopTicks() >= eventTimerDeadline)
+		eventTimerDeadline = gameLoopTicks() + eventTimerMillis;
+	bool isInput = false;
+	for (int i = 0; i < n; i++) {
+		if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+			continue;
+		if (fds[i].fd == eventWakeupFd)
+			eventWakeupDrain();
+		else
+			isInput = true;
+	}
+	return isInput;
+#else
+	gameLoopSleep();
+	return true;
+#endif
+}
+
+void FrontendIn::eventWakeup() {
+#ifndef _WINDOWS
+	if (eventWakeupWriteFd == -1)
+		return;
+	// eventfd takes exactly 8 bytes, a pipe anything
+	const uint64_t one = 1;
+	if (write(eventWakeupWriteFd, &one, sizeof(one)) == -1 && errno != EAGAIN)
+		std::printf("%s eventWakeup() write error %d\n", LOG_FACILITY.c_str(), errno);
+#endif
+}
+
+bool FrontendIn::isEventEnd() const {
+	return false;
+}
+
+void FrontendIn::eventTimer(const long millis) {
+	eventTimerMillis = millis > 0 ? millis : 0;
+#ifdef __linux__
+	if (eventTimerFd == -1)
+		return;
+	itimerspec ts {};
+	ts.it_interval.tv_sec = eventTimerMillis / 1000;
+	ts.it_interval.tv_nsec = eventTimerMillis % 1000 * 1000 * 1000;
+	ts.it_value = ts.it_interval;
+	if (timerfd_settime(eventTimerFd, 0, &ts, NULL) == -1)
+		SWFLOG(getContext(), LOG_WARN, "timerfd settime error %d", errno);
+#else
+	eventTimerDeadline = gameLoopTicks() + eventTimerMillis;
+#endif
+}
+
+
+/*
+ * game loop
+ */
+
+#ifndef _WINDOWS
+// sleep absolute to just before the deadline, spin the last fraction of a millisecond
+void FrontendIn::gameLoopSleepUntil(const long long deadline) const {
+	const long long wakeNanos = deadline - sleepSpinNanos;
+	timespec ts;
+	ts.tv_sec = wakeNanos / (1000LL * 1000LL * 1000LL);
+	ts.tv_nsec = wakeNanos % (1000LL * 1000LL * 1000LL);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+		;
+	while (gameLoopNanos() < deadline)
+		;
+}
+
+long long FrontendIn::gameLoopNanos() const {
+	timespec ts;
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		SWFLOG(getContext(), LOG_WARN, "clock gettime error");
+	return 1000LL * 1000LL * 1000LL * ts.tv_sec + ts.tv_nsec;
+}
+#else
+// override to sleep precisely until the deadline, defaults to one sleep step
+// and lets the loop check the deadline again
+void FrontendIn::gameLoopSleepUntil(const long long deadline) const {
+	if (gameLoopNanos() < deadline)
+		gameLoopSleep();
+}
+
+// override with a clock of higher resolution, defaults to scaled ticks
+long long FrontendIn::gameLoopNanos() const {
+	return gameLoopTicks() * 1000LL * 1000LL;
+}
+#endif
+
+// override where the loop clock is not real time
+long long FrontendIn::measureNanos() const {
+	return gameLoopNanos();
+}
@@ -30,6 +30,16 @@ class FrontendIn {
 private:
 	Context *context;
 
+	// event multiplexing
+	int eventPollFd;	// epoll instance, set up on first block
+	int eventWakeupFd;	// eventfd, or read end of a pipe where not available
+	int eventWakeupWriteFd;
+	int eventTimerFd;	// timerfd, -1 where not available
+	long eventTimerMillis;	// timer interval, 0 is disarmed
+	long eventTimerDeadline;	// next expiry where there is no timerfd
+	bool eventBlockInit();
+	void eventWakeupDrain() const;
+
 public:
 	FrontendIn(Context&);
 	~FrontendIn();
@@ -42,10 +52,19 @@ public:
 	virtual void* eventWait() = 0;
 	virtual void in(void*) const = 0;
 	virtual void eventFree(void*);	// some stupid apis allocate events and leave to the user
+	virtual int eventFd() const;	// pollable descriptor of the backend, -1 if there is none
+	virtual int eventSize(void*) const;	// bytes of a plain copyable event, 0 if unknown
+	bool eventBlock();		// waits for backend input, a wakeup or the timer
+	virtual void eventWakeup();	// wakes eventBlock, may be called from any thread
+	virtual bool isEventEnd() const;	// no more events will come, like at the end of a recording
+	void eventTimer(const long);	// wakes eventBlock periodically, 0 disarms
 
 	// game loop
 	virtual void gameLoopSleep() const = 0;	// gives cpu voluntary
+	virtual void gameLoopSleepUntil(const long long) const;	// sleeps until nanos deadline
 	virtual long gameLoopTicks() const = 0;	// must return ticks in milliseconds
+	virtual long long gameLoopNanos() const;	// monotonic nanoseconds, clock_gettime where available
+	virtual long long measureNanos() const;	// real monotonic nanoseconds for statistics
 
 };
 
@@ -32,6 +32,11 @@ FrontendOut::FrontendOut(Context &ctx) {
 	context->setFrontendOut(this);
 }
 
+// outputs wrapping another one share its context without replacing it
+FrontendOut::FrontendOut(Context *ctx) {
+	context = ctx;
+}
+
 FrontendOut::~FrontendOut() {
 }
 
@@ -30,6 +30,7 @@ private:
 	Context *context;
 
 protected:
+	FrontendOut(Context*);
 
 public:
 	FrontendOut(Context&);
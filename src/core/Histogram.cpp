@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Histogram.hpp"
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+Histogram::Histogram(const int windowSize) : buckets(bucketCount, 0), window(windowSize > 0 ? windowSize : 1, 0) {
+	windowIndex = 0;
+	windowCount = 0;
+}
+
+Histogram::~Histogram() {
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// values below the sub bucket count map 1:1, every following power of two is split
+// into sub bucket count linear buckets
+int Histogram::bucketIndex(long long value) {
+	if (value < 0)
+		value = 0;
+	if (value < subBucketCount)
+		return (int) value;
+	int msb = subBucketBits;
+	while (msb < maxValueBits && (value >> (msb + 1)) != 0)
+		msb++;
+	const int shift = msb - subBucketBits;
+	long long sub = value >> shift;
+	if (sub >= 2 * subBucketCount)
+		sub = 2 * subBucketCount - 1;
+	return (shift + 1) * subBucketCount + (int) (sub - subBucketCount);
+}
+
+// highest value that falls into the bucket
+long long Histogram::bucketValue(const int index) {
+	if (index < subBucketCount)
+		return index;
+	const int shift = index / subBucketCount - 1;
+	const long long sub = index % subBucketCount + subBucketCount;
+	return ((sub + 1) << shift) - 1;
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+void Histogram::record(long long value) {
+	if (windowCount == (int) window.size())
+		buckets[bucketIndex(window[windowIndex])]--;
+	else
+		windowCount++;
+	window[windowIndex] = value;
+	buckets[bucketIndex(value)]++;
+	windowIndex = (windowIndex + 1) % window.size();
+}
+
+void Histogram::reset() {
+	std::fill(buckets.begin(), buckets.end(), 0);
+	windowIndex = 0;
+	windowCount = 0;
+}
+
+// percentile between 0 and 100 of the samples in the window
+long long Histogram::percentile(const double p) const {
+	if (windowCount == 0)
+		return 0;
+	long long target = (long long) std::ceil(p / 100.0 * windowCount);
+	if (target < 1)
+		target = 1;
+	long long seen = 0;
+	for (int i = 0; i < bucketCount; i++) {
+		seen += buckets[i];
+		if (seen >= target)
+			return bucketValue(i);
+	}
+	return bucketValue(bucketCount - 1);
+}
+
+HistogramStat Histogram::stat() const {
+	HistogramStat s { 0, 0, 0, 0, windowCount };
+	if (windowCount == 0)
+		return s;
+	const long long t50 = (windowCount * 50LL + 99) / 100;
+	const long long t90 = (windowCount * 90LL + 99) / 100;
+	const long long t99 = (windowCount * 99LL + 99) / 100;
+	long long seen = 0;
+	for (int i = 0; i < bucketCount && seen < t99; i++) {
+		if (buckets[i] == 0)
+			continue;
+		const long long previous = seen;
+		seen += buckets[i];
+		if (previous < t50 && seen >= t50)
+			s.p50 = bucketValue(i);
+		if (previous < t90 && seen >= t90)
+			s.p90 = bucketValue(i);
+		if (seen >= t99)
+			s.p99 = bucketValue(i);
+	}
+	for (int i = 0; i < windowCount; i++)
+		if (window[i] > s.max)
+			s.max = window[i];
+	// bucket values are upper bounds, do not report more than was measured
+	s.p50 = std::min(s.p50, s.max);
+	s.p90 = std::min(s.p90, s.max);
+	s.p99 = std::min(s.p99, s.max);
+	return s;
+}
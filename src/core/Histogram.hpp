@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_HISTOGRAM
+#define SWF_CORE_HISTOGRAM
+
+#include <vector>
+
+struct HistogramStat {
+	long long p50, p90, p99, max;
+	int count;
+};
+
+// log-linear histogram over a sliding window of samples, buckets keep about 3%
+// precision over the whole range like a hdr histogram with 2 significant digits
+class Histogram {
+
+private:
+	static const int subBucketBits = 5;
+	static const int subBucketCount = 1 << subBucketBits;
+	static const int maxValueBits = 40;	// ~18 minutes in nanos
+	static const int bucketCount = (maxValueBits - subBucketBits + 2) * subBucketCount;
+
+	std::vector<int> buckets;
+	std::vector<long long> window;		// ring of recent samples
+	int windowIndex;
+	int windowCount;
+
+	static int bucketIndex(long long);
+	static long long bucketValue(const int);
+
+public:
+	Histogram(const int);
+	~Histogram();
+
+	void record(long long);
+	void reset();
+	long long percentile(const double) const;
+	HistogramStat stat() const;
+
+};
+
+#endif // SWF_CORE_HISTOGRAM
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "Logger.hpp"
+
+#ifdef _WINDOWS
+#include "../frontend/out/GdiOut.hpp"
+#endif
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+Logger::Logger() : slots(new Slot[queueSize]), overlay(overlaySize) {
+	for (int i = 0; i < queueSize; i++)
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	enqueuePosition.store(0, std::memory_order_relaxed);
+	dequeuePosition = 0;
+	dropped.store(0, std::memory_order_relaxed);
+	for (auto &line : overlay)
+		line.reserve(facilitySize + functionSize + messageSize + 4);
+	overlayHead = 0;
+	overlayCount = 0;
+	isRunning.store(true);
+	isSleeping.store(false);
+	flushWaiters = 0;
+	writer = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger() {
+	{
+		std::lock_guard<std::mutex> lock { writerMutex };
+		isRunning.store(false);
+	}
+	writerCondition.notify_all();
+	writer.join();
+	drain();
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+
+/*
+ * writer
+ */
+
+void Logger::run() {
+	std::unique_lock<std::mutex> lock { writerMutex };
+	while (isRunning.load()) {
+		if (drain()) {
+			if (flushWaiters > 0)
+				writerCondition.notify_all();
+			continue;
+		}
+		// announce the sleep and look once more, a record published before the producer
+		// could see the flag is written here
+		isSleeping.store(true);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (drain()) {
+			isSleeping.store(false);
+			if (flushWaiters > 0)
+				writerCondition.notify_all();
+			continue;
+		}
+		writerCondition.wait(lock, [this] { return !isSleeping.load() || !isRunning.load(); });
+	}
+}
+
+// writes all queued records, returns false if there were none
+bool Logger::drain() {
+	bool isAny = false;
+	for (;;) {
+		Slot &slot = slots[dequeuePosition & (queueSize - 1)];
+		const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+		if (sequence != dequeuePosition + 1)
+			return isAny;
+		write(slot.record);
+		slot.sequence.store(dequeuePosition + queueSize, std::memory_order_release);
+		dequeuePosition++;
+		isAny = true;
+	}
+}
+
+void Logger::write(const Record &r) {
+	char line[facilitySize + functionSize + messageSize + 8];
+	std::snprintf(line, sizeof(line), "%d %-16.16s %-24.24s%s", r.level, r.facility, r.function, r.message);
+	{
+		std::lock_guard<std::mutex> lock { overlayMutex };
+		int index;
+		if (overlayCount < overlaySize) {
+			index = (overlayHead + overlayCount) % overlaySize;
+			overlayCount++;
+		} else {
+			index = overlayHead;
+			overlayHead = (overlayHead + 1) % overlaySize;
+		}
+		overlay[index].assign(line);
+	}
+	if (r.isPrint)
+		std::printf("%s\n", line);
+#ifdef _WINDOWS
+	if (r.isAlert)
+		GdiOut::messageBox(0, line);
+#endif
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// message is formatted here, everything else on the writer thread; when the queue
+// is full the record is dropped rather than blocking the caller
+void Logger::log(const int level, const std::basic_string<char> &facility, const char *function, const bool isPrint,
+	    const bool isAlert, const char *format, va_list arg) {
+	std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+	Slot *slot;
+	for (;;) {
+		slot = &slots[position & (queueSize - 1)];
+		const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t diff = (std::ptrdiff_t) sequence - (std::ptrdiff_t) position;
+		if (diff == 0) {
+			if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		} else if (diff < 0) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		} else {
+			position = enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+	Record &r = slot->record;
+	r.level = level;
+	r.isPrint = isPrint;
+	r.isAlert = isAlert;
+	std::strncpy(r.facility, facility.c_str(), facilitySize);
+	r.facility[facilitySize] = 0;
+	std::strncpy(r.function, function != nullptr ? function : "", functionSize);
+	r.function[functionSize] = 0;
+	if (format != nullptr)
+		std::vsnprintf(r.message, messageSize, format, arg);
+	else
+		r.message[0] = 0;
+	slot->sequence.store(position + 1, std::memory_order_release);
+	// wakes the writer only when it sleeps on an empty queue, otherwise no syscall
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (isSleeping.load(std::memory_order_relaxed) && isSleeping.exchange(false)) {
+		std::lock_guard<std::mutex> lock { writerMutex };
+		writerCondition.notify_all();
+	}
+}
+
+// waits until the writer has caught up with everything logged so far, the writer
+// signals after each drain while someone waits
+void Logger::flush() {
+	const std::size_t position = enqueuePosition.load(std::memory_order_acquire);
+	std::unique_lock<std::mutex> lock { writerMutex };
+	flushWaiters++;
+	writerCondition.wait(lock, [this, position] { return dequeuePosition >= position || !isRunning.load(); });
+	flushWaiters--;
+}
+
+long Logger::getDropped() const {
+	return dropped.load(std::memory_order_relaxed);
+}
+
+
+/*
+ * overlay
+ */
+
+int Logger::overlayLines() {
+	std::lock_guard<std::mutex> lock { overlayMutex };
+	return overlayCount;
+}
+
+// calls back with every overlay line and its index, oldest first
+void Logger::overlayTraverse(void (*cb)(const std::basic_string<char>&, const int, void*), void *userData) {
+	std::lock_guard<std::mutex> lock { overlayMutex };
+	for (int i = 0; i < overlayCount; i++)
+		cb(overlay[(overlayHead + i) % overlaySize], i, userData);
+}
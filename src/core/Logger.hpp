@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_LOGGER
+#define SWF_CORE_LOGGER
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// asynchronous log pipeline: callers format only the message into a fixed size record
+// of a lock-free bounded queue (multi producer, single consumer), a writer thread does
+// the line formatting, the printing and feeds the overlay lines
+class Logger {
+
+private:
+	static const int queueSize = 1024;	// power of two
+	static const int overlaySize = 20;
+	static const int facilitySize = 16;
+	static const int functionSize = 24;
+	static const int messageSize = 160;
+
+	struct Record {
+		int level;
+		bool isPrint;		// print to stdout
+		bool isAlert;		// show a message box where supported
+		char facility[facilitySize + 1];
+		char function[functionSize + 1];
+		char message[messageSize];
+	};
+
+	struct Slot {
+		std::atomic<std::size_t> sequence;
+		Record record;
+	};
+
+	// queue
+	std::unique_ptr<Slot[]> slots;
+	std::atomic<std::size_t> enqueuePosition;
+	std::size_t dequeuePosition;		// writer thread only
+	std::atomic<long> dropped;
+
+	// writer, sleeps while the queue is empty, the first producer after it went to sleep
+	// wakes it, the others only read the flag
+	std::atomic<bool> isRunning;
+	std::atomic<bool> isSleeping;
+	std::mutex writerMutex;
+	std::condition_variable writerCondition;	// writer and flush waiters
+	int flushWaiters;				// guarded by writerMutex
+	std::thread writer;
+	void run();
+	bool drain();
+	void write(const Record&);
+
+	// overlay, preallocated lines that are reused
+	std::mutex overlayMutex;
+	std::vector<std::basic_string<char>> overlay;
+	int overlayHead;			// index of the oldest line
+	int overlayCount;
+
+public:
+	Logger();
+	~Logger();
+
+	void log(const int, const std::basic_string<char>&, const char*, const bool, const bool, const char*, va_list);
+	void flush();
+	long getDropped() const;
+
+	// overlay
+	int overlayLines();
+	void overlayTraverse(void (*)(const std::basic_string<char>&, const int, void*), void*);
+
+};
+
+#endif // SWF_CORE_LOGGER
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Pool.hpp"
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+Pool::Pool(const std::size_t objectSize, const int slots) {
+	const std::size_t align = alignof(std::max_align_t);
+	size = (std::max(objectSize, sizeof(void*)) + align - 1) / align * align;
+	slabSlots = slots > 0 ? slots : 1;
+	freeList = nullptr;
+	inUse = 0;
+}
+
+Pool::~Pool() {
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// threads the slots of a new slab onto the free list, lowest address first
+void Pool::grow() {
+	const std::size_t units = (size * slabSlots + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+	slabs.emplace_back(new std::max_align_t[units]);
+	char *slab = (char*) slabs.back().get();
+	for (int i = slabSlots - 1; i >= 0; i--) {
+		void *slot = slab + i * size;
+		*(void**) slot = freeList;
+		freeList = slot;
+	}
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+void* Pool::allocate() {
+	if (freeList == nullptr)
+		grow();
+	void *slot = freeList;
+	freeList = *(void**) slot;
+	inUse++;
+	return slot;
+}
+
+void Pool::release(void *slot) {
+	*(void**) slot = freeList;
+	freeList = slot;
+	inUse--;
+}
+
+
+/*
+ * getter
+ */
+
+std::size_t Pool::getSize() const {
+	return size;
+}
+
+long Pool::getInUse() const {
+	return inUse;
+}
+
+int Pool::getSlabCount() const {
+	return slabs.size();
+}
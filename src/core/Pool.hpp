@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_POOL
+#define SWF_CORE_POOL
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// fixed size slab allocator, freed slots go onto an intrusive free list and are reused
+// first, slabs are only returned to the system when the pool dies
+class Pool {
+
+private:
+	std::size_t size;		// slot size, a multiple of the alignment of max_align_t
+	int slabSlots;
+	std::vector<std::unique_ptr<std::max_align_t[]>> slabs;
+	void *freeList;
+	long inUse;
+
+	void grow();
+
+public:
+	Pool(const std::size_t, const int);
+	~Pool();
+
+	void* allocate();
+	void release(void*);
+
+	// getter
+	std::size_t getSize() const;
+	long getInUse() const;
+	int getSlabCount() const;
+
+};
+
+#endif // SWF_CORE_POOL
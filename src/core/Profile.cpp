@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "Profile.hpp"
+
+#ifdef SWF_PROFILE
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+static const std::basic_string<char> LOG_FACILITY = "PROFILE";
+
+// buffers of all threads that ever recorded, kept alive after thread exit for dumping
+static std::mutex buffersMutex;
+static std::vector<std::unique_ptr<ProfileBuffer>> buffers;
+
+
+/*
+ * ******************************************************** private
+ */
+
+ProfileBuffer* Profile::threadBuffer() {
+	std::unique_ptr<ProfileBuffer> buffer { new ProfileBuffer() };
+	buffer->events.resize(bufferSize);
+	buffer->head.store(0);
+	buffer->cleared.store(0);
+	std::lock_guard<std::mutex> lock { buffersMutex };
+	buffer->threadId = (int) buffers.size() + 1;
+	buffers.push_back(std::move(buffer));
+	return buffers.back().get();
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// writes the recorded zones as chrome trace event json, events that are overwritten
+// by other threads while dumping may be torn, so dump from a quiet point of the loop
+bool Profile::dump(const char *path) {
+	FILE *f = std::fopen(path, "w");
+	if (f == nullptr) {
+		std::printf("%s dump() cannot open %s\n", LOG_FACILITY.c_str(), path);
+		return false;
+	}
+	std::fprintf(f, "{\"traceEvents\":[\n");
+	bool isFirst = true;
+	std::lock_guard<std::mutex> lock { buffersMutex };
+	for (const auto &buffer : buffers) {
+		const uint64_t head = buffer->head.load(std::memory_order_acquire);
+		const uint64_t cleared = buffer->cleared.load(std::memory_order_relaxed);
+		const uint64_t first = std::max(head > (uint64_t) bufferSize ? head - bufferSize : 0, cleared);
+		for (uint64_t i = first; i < head; i++) {
+			const ProfileEvent &e = buffer->events[i % bufferSize];
+			std::fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			    isFirst ? "" : ",\n", e.name, buffer->threadId, e.start / 1000.0, e.duration / 1000.0);
+			isFirst = false;
+		}
+	}
+	std::fprintf(f, "\n]}\n");
+	std::fclose(f);
+	return true;
+}
+
+// only the owning thread writes head, so other buffers are cleared by remembering where
+// their events start again
+void Profile::clear() {
+	std::lock_guard<std::mutex> lock { buffersMutex };
+	for (const auto &buffer : buffers)
+		buffer->cleared.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+#endif // SWF_PROFILE
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_PROFILE
+#define SWF_CORE_PROFILE
+
+// scoped profiling zones, compiled in with -DSWF_PROFILE only:
+//
+//	void Foo::bar() {
+//		SWF_ZONE("Foo::bar");
+//		...
+//
+// every zone records name, start and duration into a ring buffer of the calling
+// thread, Context::profileDump() writes the buffers as chrome trace events
+
+#ifdef SWF_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+struct ProfileEvent {
+	const char *name;	// must be a literal, only the pointer is stored
+	int64_t start;		// nanos
+	int64_t duration;
+};
+
+struct ProfileBuffer {
+	std::vector<ProfileEvent> events;
+	std::atomic<uint64_t> head;	// events written so far, ring index is head % size
+	std::atomic<uint64_t> cleared;	// head at the last clear, older events are not dumped
+	int threadId;
+};
+
+class Profile {
+
+private:
+	static ProfileBuffer* threadBuffer();
+
+public:
+	static const int bufferSize = 1 << 16;
+
+	static inline int64_t now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		    std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+	static inline void record(const char *name, const int64_t start, const int64_t end) {
+		static thread_local ProfileBuffer *buffer = threadBuffer();
+		const uint64_t h = buffer->head.load(std::memory_order_relaxed);
+		buffer->events[h % bufferSize] = { name, start, end - start };
+		buffer->head.store(h + 1, std::memory_order_release);
+	}
+	static bool dump(const char*);
+	static void clear();
+
+};
+
+class ProfileZone {
+
+private:
+	const char *name;
+	const int64_t start;
+
+public:
+	inline ProfileZone(const char *n) : name(n), start(Profile::now()) { }
+	inline ~ProfileZone() { Profile::record(name, start, Profile::now()); }
+
+};
+
+#define SWF_ZONE_CONCAT_(A, B) A##B
+#define SWF_ZONE_CONCAT(A, B) SWF_ZONE_CONCAT_(A, B)
+#define SWF_ZONE(NAME) ProfileZone SWF_ZONE_CONCAT(swfZone, __LINE__) { NAME }
+
+#else
+
+#define SWF_ZONE(NAME) do { } while (0)
+
+#endif // SWF_PROFILE
+
+#endif // SWF_CORE_PROFILE
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "ScrollContainer.hpp"
+
+#include "Context.hpp"
+#include "FrontendOut.hpp"
+#include "Profile.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "SCROLL_CONTAINER";
+
+
+/*
+ * constructor, destructor
+ */
+
+ScrollContainer::ScrollContainer(Context *ctx) : Container(ctx) {
+	scrollX = 0;
+	scrollY = 0;
+	viewport = {{0, 0, 0, 0, 0, 0}, 0, 0, 0, 0};
+}
+
+ScrollContainer::ScrollContainer(Container *c) : Container(c) {
+	scrollX = 0;
+	scrollY = 0;
+	viewport = {{0, 0, 0, 0, 0, 0}, 0, 0, 0, 0};
+}
+
+ScrollContainer::~ScrollContainer() {
+}
+
+
+/*
+ * private
+ */
+
+// rows in content coordinates, the viewport offset is applied when drawing
+void ScrollContainer::calculatePosition(const int childIndex, const Style &childStyle, Position *childPos) {
+	SWF_ZONE("ScrollContainer::calculatePosition");
+	const Position *pos = getPosition();
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	childPos->w = std::max(pos->w - 2 * space, 1);
+	childPos->h = rowHeight();
+	childPos->x = pos->x + space;
+	childPos->y = pos->y + space + childIndex * childPos->h;
+}
+
+// rows have a fixed height, a resized row moves no sibling
+void ScrollContainer::onContentsResized(Component *c) {
+}
+
+int ScrollContainer::rowHeight() {
+	const Style *stl = getStyle();
+	return getContext()->getFrontendOut()->fontDimension().second + 2 * (stl->margin + stl->padding);
+}
+
+
+/*
+ * protected
+ */
+
+// places the dirty rows in view, the others keep their flags until scrolled into view
+int ScrollContainer::layoutChildren() {
+	SWF_ZONE("ScrollContainer::layoutChildren");
+	const Viewport *v = getViewport();
+	if (v == nullptr)
+		return 0;
+	const std::vector<Component*> &cs = *contents();
+	Position childPos;
+	int count = 0;
+	for (int i = std::max(v->first, firstDirtyChild()); i < v->last; i++) {
+		if (!isPositionDirty(cs[i]))
+			continue;
+		calculatePosition(i, *getStyle(cs[i]), &childPos);
+		setPosition(cs[i], childPos);
+		count++;
+	}
+	getContext()->layoutCount(count, 0);
+	return count;
+}
+
+// the inner rect of the container, the visible rows follow from the scroll offset
+const Viewport* ScrollContainer::getViewport() {
+	const Position *pos = getPosition();
+	if (pos == nullptr)
+		return nullptr;
+	const Style *stl = getStyle();
+	const int space = stl->margin + stl->padding;
+	const int step = rowHeight();
+	const int rows = contents()->size();
+	viewport.clip = {pos->x + space, pos->y + space, std::max(pos->w - 2 * space, 0),
+	    std::max(pos->h - 2 * space, 0), pos->x + space, pos->y + space};
+	viewport.offsetX = scrollX;
+	viewport.offsetY = scrollY;
+	viewport.first = std::min(scrollY / step, rows);
+	viewport.last = std::min((scrollY + viewport.clip.h + step - 1) / step, rows);
+	return &viewport;
+}
+
+
+/*
+ * public
+ */
+
+void ScrollContainer::scrollBy(const int dx, const int dy) {
+	setScrollOffset(scrollX + dx, scrollY + dy);
+}
+
+// height of all rows, the scroll range is this minus the viewport height
+int ScrollContainer::getContentHeight() {
+	return contents()->size() * rowHeight();
+}
+
+
+/*
+ * getter / setter
+ */
+
+std::pair<int,int> ScrollContainer::getScrollOffset() const {
+	return { scrollX, scrollY };
+}
+
+// rows keep their positions, rows coming into view for the first time get laid out on
+// the next pass
+void ScrollContainer::setScrollOffset(const int x, const int y) {
+	const int sx = std::max(x, 0);
+	const int sy = std::max(y, 0);
+	if (sx == scrollX && sy == scrollY)
+		return;
+	scrollX = sx;
+	scrollY = sy;
+	const Viewport *v = getViewport();
+	if (v != nullptr && v->first < v->last)
+		markAncestors((*contents())[v->first]);
+	getContext()->contentsChanged();
+	SWFLOG(getContext(), LOG_DEBUG, "%d+%d rows %d-%d", scrollX, scrollY, v == nullptr ? 0 : v->first,
+	    v == nullptr ? 0 : v->last);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_SCROLL_CONTAINER
+#define SWF_CORE_SCROLL_CONTAINER
+
+#include <utility>
+#include <vector>
+
+#include "Component.hpp"
+#include "Container.hpp"
+
+// stacks its children as rows like ContainerList, the rows may extend past the
+// container and are shown through a viewport, scrolling moves the viewport without
+// laying out the rows again, rows out of view are neither laid out nor drawn
+class ScrollContainer : public Container {
+
+private:
+	int scrollX, scrollY;
+	Viewport viewport;
+
+	void calculatePosition(const int, const Style&, Position*) override;
+	void onContentsResized(Component*) override;
+	int rowHeight();
+
+protected:
+	int layoutChildren() override;
+	const Viewport* getViewport() override;
+
+public:
+	ScrollContainer(Context*);
+	ScrollContainer(Container*);
+	~ScrollContainer();
+
+	void scrollBy(const int, const int);
+	int getContentHeight();
+
+	// getter / setter
+	std::pair<int,int> getScrollOffset() const;
+	void setScrollOffset(const int, const int);
+
+};
+
+#endif // SWF_CORE_SCROLL_CONTAINER
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "SpatialIndex.hpp"
+
+#include "Profile.hpp"
+
+
+// entries per cell the grid is sized for
+static const int entriesPerCell = 2;
+static const int cellsMax = 1 << 16;
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+SpatialIndex::SpatialIndex() {
+	clear();
+}
+
+SpatialIndex::~SpatialIndex() {
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// cells covered by the rect clipped to the screen, false when nothing is on screen
+bool SpatialIndex::cellRange(const Position &p, int *c0, int *r0, int *c1, int *r1) const {
+	if (p.w <= 0 || p.h <= 0 || p.x >= width || p.y >= height || p.x + p.w <= 0 || p.y + p.h <= 0)
+		return false;
+	*c0 = std::max(p.x, 0) / cellWidth;
+	*r0 = std::max(p.y, 0) / cellHeight;
+	*c1 = (std::min(p.x + p.w, width) - 1) / cellWidth;
+	*r1 = (std::min(p.y + p.h, height) - 1) / cellHeight;
+	return true;
+}
+
+
+// appends the components below c shifted by the offsets of the viewports above and cut
+// to their clip rect, the contents of a viewport are collected in its place to keep
+// the tree order
+void SpatialIndex::collect(Component *root, const int dx, const int dy, const Position &clip) {
+	Component::visitInclusive(root, [this, dx, dy, &clip](Component *c) {
+		const Position *p = c->getPosition();
+		if (p != nullptr) {
+			const int x0 = std::max(p->x - dx, clip.x);
+			const int y0 = std::max(p->y - dy, clip.y);
+			const int x1 = std::min(p->x - dx + p->w, clip.x + clip.w);
+			const int y1 = std::min(p->y - dy + p->h, clip.y + clip.h);
+			if (x0 < x1 && y0 < y1)
+				entries.push_back({c, {x0, y0, x1 - x0, y1 - y0, x0, y0}});
+		}
+		const Viewport *v = c->getViewport();
+		if (v == nullptr)
+			return TraverseCondition::notMatch;
+		const int x0 = std::max(v->clip.x - dx, clip.x);
+		const int y0 = std::max(v->clip.y - dy, clip.y);
+		const int x1 = std::min(v->clip.x - dx + v->clip.w, clip.x + clip.w);
+		const int y1 = std::min(v->clip.y - dy + v->clip.h, clip.y + clip.h);
+		const Position inner {x0, y0, std::max(x1 - x0, 0), std::max(y1 - y0, 0), x0, y0};
+		const std::vector<Component*> &cs = *c->contents();
+		for (int i = v->first; i < v->last; i++)
+			collect(cs[i], dx + v->offsetX, dy + v->offsetY, inner);
+		return TraverseCondition::notMatchSkip;
+	});
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// indexes the laid out components below root on a screen of the given dimension,
+// returns the number of indexed components
+int SpatialIndex::build(Component *root, const std::pair<int,int> &screen) {
+	SWF_ZONE("SpatialIndex::build");
+	clear();
+	if (root == nullptr || screen.first <= 0 || screen.second <= 0)
+		return 0;
+	width = screen.first;
+	height = screen.second;
+	collect(root, 0, 0, {0, 0, width, height, 0, 0});
+	// square cells, about entriesPerCell entries each
+	const int cells = std::min(std::max((int) entries.size() / entriesPerCell, 1), cellsMax);
+	const int side = std::max((int) std::ceil(std::sqrt((double) width * height / cells)), 1);
+	cellWidth = side;
+	cellHeight = side;
+	columns = (width + side - 1) / side;
+	rows = (height + side - 1) / side;
+	// two passes, count per cell, then fill
+	cellStart.assign(columns * rows + 1, 0);
+	int c0, r0, c1, r1;
+	for (const Entry &e : entries) {
+		cellRange(e.position, &c0, &r0, &c1, &r1);
+		for (int r = r0; r <= r1; r++)
+			for (int c = c0; c <= c1; c++)
+				cellStart[r * columns + c + 1]++;
+	}
+	for (std::size_t i = 1; i < cellStart.size(); i++)
+		cellStart[i] += cellStart[i - 1];
+	cellEntries.resize(cellStart.back());
+	std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+	for (std::size_t i = 0; i < entries.size(); i++) {
+		cellRange(entries[i].position, &c0, &r0, &c1, &r1);
+		for (int r = r0; r <= r1; r++)
+			for (int c = c0; c <= c1; c++)
+				cellEntries[fill[r * columns + c]++] = i;
+	}
+	return entries.size();
+}
+
+void SpatialIndex::clear() {
+	entries.clear();
+	cellStart.assign(1, 0);
+	cellEntries.clear();
+	width = 0;
+	height = 0;
+	cellWidth = 1;
+	cellHeight = 1;
+	columns = 0;
+	rows = 0;
+}
+
+// deepest component containing the point, the last one in tree order, or nullptr
+Component* SpatialIndex::find(const int x, const int y) const {
+	if (x < 0 || y < 0 || x >= width || y >= height)
+		return nullptr;
+	// cells list their entries in tree order, the first hit from the back is the deepest
+	const int cell = (y / cellHeight) * columns + x / cellWidth;
+	for (int i = cellStart[cell + 1] - 1; i >= cellStart[cell]; i--) {
+		const Entry &e = entries[cellEntries[i]];
+		const Position &p = e.position;
+		if (x >= p.x && x < p.x + p.w && y >= p.y && y < p.y + p.h)
+			return e.component;
+	}
+	return nullptr;
+}
+
+// appends the components intersecting the rect in cell order, an entry spanning several
+// cells is reported by the first cell of the overlap only, returns the number found
+int SpatialIndex::find(const Position &rect, std::vector<Component*> *found) const {
+	int c0, r0, c1, r1;
+	if (!cellRange(rect, &c0, &r0, &c1, &r1))
+		return 0;
+	const std::size_t first = found->size();
+	for (int r = r0; r <= r1; r++) {
+		for (int c = c0; c <= c1; c++) {
+			const int cell = r * columns + c;
+			for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+				const Position &p = entries[cellEntries[i]].position;
+				if (p.x >= rect.x + rect.w || p.x + p.w <= rect.x || p.y >= rect.y + rect.h || p.y + p.h <= rect.y)
+					continue;
+				const int x = std::max(std::max(p.x, rect.x), 0);
+				const int y = std::max(std::max(p.y, rect.y), 0);
+				if (x / cellWidth == c && y / cellHeight == r)
+					found->push_back(entries[cellEntries[i]].component);
+			}
+		}
+	}
+	return found->size() - first;
+}
+
+
+/*
+ * getter
+ */
+
+int SpatialIndex::size() const {
+	return entries.size();
+}
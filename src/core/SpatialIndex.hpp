@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_SPATIAL_INDEX
+#define SWF_CORE_SPATIAL_INDEX
+
+#include <utility>
+#include <vector>
+
+#include "Component.hpp"
+
+// uniform grid over the screen holding the laid out component rects, cells are sized
+// for a few components each, so point and rect queries look at a handful of entries,
+// components outside the screen or the viewport showing them cannot be hit and are not
+// indexed
+class SpatialIndex {
+
+private:
+	struct Entry {
+		Component *component;
+		Position position;
+	};
+
+	// entries in tree order, a later entry is deeper or drawn above an earlier one
+	std::vector<Entry> entries;
+	std::vector<int> cellStart;		// entries of cell i are cellEntries[cellStart[i]..cellStart[i+1]]
+	std::vector<int> cellEntries;
+	int width, height;
+	int cellWidth, cellHeight;
+	int columns, rows;
+
+	bool cellRange(const Position&, int*, int*, int*, int*) const;
+	void collect(Component*, const int, const int, const Position&);
+
+public:
+	SpatialIndex();
+	~SpatialIndex();
+
+	int build(Component*, const std::pair<int,int>&);
+	void clear();
+
+	Component* find(const int, const int) const;
+	int find(const Position&, std::vector<Component*>*) const;
+
+	// getter
+	int size() const;
+
+};
+
+#endif // SWF_CORE_SPATIAL_INDEX
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "ViewportOut.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "VIEWPORT_OUT";
+
+static const std::basic_string<char> noText {};
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+ViewportOut::ViewportOut(const FrontendOut &o, const Viewport &v) : FrontendOut(o.getContext()), out(o), viewport(v) {
+}
+
+ViewportOut::~ViewportOut() {
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+void ViewportOut::draw(const Position &position, const Style &style, const std::basic_string<char> &text) const {
+	const Position &clip = viewport.clip;
+	Position p = position;
+	p.x -= viewport.offsetX;
+	p.y -= viewport.offsetY;
+	p.textX -= viewport.offsetX;
+	p.textY -= viewport.offsetY;
+	const int x0 = std::max(p.x, clip.x);
+	const int y0 = std::max(p.y, clip.y);
+	const int x1 = std::min(p.x + p.w, clip.x + clip.w);
+	const int y1 = std::min(p.y + p.h, clip.y + clip.h);
+	if (x0 >= x1 || y0 >= y1)
+		return;
+	if (x0 == p.x && y0 == p.y && x1 == p.x + p.w && y1 == p.y + p.h) {
+		out.draw(p, style, text);
+		return;
+	}
+	const int fontHeight = out.fontDimension().second;
+	const bool isTextVisible = p.textY >= y0 && p.textY + fontHeight <= y1 && p.textX >= x0 && p.textX < x1;
+	p.x = x0;
+	p.y = y0;
+	p.w = x1 - x0;
+	p.h = y1 - y0;
+	out.draw(p, style, isTextVisible ? text : noText);
+}
+
+std::pair<int,int> ViewportOut::screenDimension() const {
+	return out.screenDimension();
+}
+
+std::pair<int,int> ViewportOut::fontDimension() const {
+	return out.fontDimension();
+}
+
+// the wrapped output finishes the frame
+void ViewportOut::gameLoopDrawFinish() const {
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_CORE_VIEWPORT_OUT
+#define SWF_CORE_VIEWPORT_OUT
+
+#include <string>
+#include <utility>
+
+#include "Component.hpp"
+#include "FrontendOut.hpp"
+
+// draws through another output shifted by the viewport offset, components outside the
+// clip rect are dropped, partly visible ones are cut to it and lose their text when the
+// text line does not fit
+class ViewportOut : public FrontendOut {
+
+private:
+	const FrontendOut &out;
+	const Viewport &viewport;
+
+public:
+	ViewportOut(const FrontendOut&, const Viewport&);
+	~ViewportOut();
+
+	void draw(const Position&, const Style&, const std::basic_string<char>&) const override;
+	std::pair<int,int> screenDimension() const override;
+	std::pair<int,int> fontDimension() const override;
+	void gameLoopDrawFinish() const override;
+
+};
+
+#endif // SWF_CORE_VIEWPORT_OUT
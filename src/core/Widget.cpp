@@ -14,6 +14,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <cstring>
+
 #include "Widget.hpp"
 
 
@@ -34,10 +36,11 @@ static std::vector<Component*> noContents {};
 Widget::Widget(Container *c) : Component(c) {
 	SWFLOG(getContext(), LOG_DEBUG, nullptr);
 	style = {3, 3};
+	isTextSet = false;
 }
 
 Widget::~Widget() {
-	SWFLOG(getContext(), LOG_WARN, nullptr);
+	SWFLOG(getContext(), LOG_DEBUG, nullptr);
 }
 
 
@@ -49,6 +52,24 @@ void Widget::addToContents(Component *c) {
 	SWFLOG(getContext(), LOG_WARN, "cannot add contents to a widget");
 }
 
+void Widget::removeFromContents(Component *c) {
+	SWFLOG(getContext(), LOG_WARN, "widget has no contents");
+}
+
+// reuses the capacity, rebinding a recycled widget from a buffer does not allocate;
+// a longer or shorter text changes the measured size
+void Widget::assignText(const char *t, const std::size_t length) {
+	const std::size_t size = getText().size();
+	text.assign(t, length);
+	if (!isTextSet) {
+		// the placeholder was drawn until now
+		isTextSet = true;
+		getContext()->textReplaced();
+	}
+	if (text.size() != size)
+		invalidateContent();
+}
+
 /*
 void Widget::onDraw(const Display *display) {
 //	std::pair<int,int> *off = getOffset();
@@ -60,6 +81,16 @@ void Widget::onDraw(const Display *display) {
 */
 
 
+/*
+ * protected
+ */
+
+// the component default until a text is set, an empty text stays empty
+const std::basic_string<char>& Widget::getText() const {
+	return isTextSet ? text : Component::getText();
+}
+
+
 /*
  * public
  */
@@ -69,3 +100,10 @@ std::vector<Component*>* Widget::contents() {
 	return &noContents;
 }
 
+void Widget::setText(const std::basic_string<char> &t) {
+	assignText(t.data(), t.size());
+}
+
+void Widget::setText(const char *t) {
+	assignText(t, std::strlen(t));
+}
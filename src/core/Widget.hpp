@@ -17,15 +17,23 @@
 #ifndef SWF_CORE_WIDGET
 #define SWF_CORE_WIDGET
 
+#include <string>
+
 #include "Component.hpp"
 
 class Widget : public Component {
 
 private:
+	std::basic_string<char> text;
+	bool isTextSet;		// never set widgets show the component default
+	void assignText(const char*, const std::size_t);
+
 	void addToContents(Component*) override;
+	void removeFromContents(Component*) override;
 //	void onDraw(const Display*) override;
 
 protected:
+	const std::basic_string<char>& getText() const override;
 
 public:
 	Widget(Container*);
@@ -33,6 +41,9 @@ public:
 
 	std::vector<Component*>* contents() override;
 
+	void setText(const std::basic_string<char>&);
+	void setText(const char*);
+
 };
 
 #endif // SWF_CORE_WIDGET
@@ -67,12 +67,12 @@ static void randomizeBox(Box &box) {
 	box.velocity.second = std::rand() % (boxMaxVel - 1) + 1;
 }
 
-// scale box to screen positions
-static bool scaleBox(const Box &box, Box &boxScr, const std::pair<int,int> &scrDim) {
+// scale box to screen positions, alpha interpolates towards the next simulation tick
+static bool scaleBox(const Box &box, Box &boxScr, const std::pair<int,int> &scrDim, const float alpha) {
 	const float scaleX = (float) scrDim.first / boxFieldDim.first;
 	const float scaleY = (float) scrDim.second / boxFieldDim.second;
-	boxScr.offset.first = (int) std::round(scaleX * box.offset.first);
-	boxScr.offset.second = (int) std::round(scaleY * box.offset.second);
+	boxScr.offset.first = (int) std::round(scaleX * (box.offset.first + alpha * box.velocity.first));
+	boxScr.offset.second = (int) std::round(scaleY * (box.offset.second + alpha * box.velocity.second));
 	boxScr.dimension.first = (int) std::round(scaleX * box.dimension.first);
 	if (boxScr.dimension.first < 1)
 		boxScr.dimension.first = 1;
@@ -201,7 +201,7 @@ static int onEventCurses(void *event, void *data) {
 	return 0;
 }
 
-static void onDrawCurses(void *data) {
+static void onDrawCurses(const float alpha, void *data) {
 	const Env *env = (const Env*) data;
 	Context *ctx = env->context;
 	const CursesOut *out = (const CursesOut*) ctx->getFrontendOut();
@@ -214,7 +214,7 @@ static void onDrawCurses(void *data) {
 		init_pair(i, i & 7, (i + 5) & 7);
 	for (auto &box : env->boxes) {
 		i++;
-		if (!scaleBox(*box.get(), boxScr, scrDim))
+		if (!scaleBox(*box.get(), boxScr, scrDim, alpha))
 			continue;
 		std::memset(buf, 0, 100);
 		std::memset(buf, '#', boxScr.dimension.first);
@@ -230,7 +230,7 @@ static int startCurses(Env &env) {
 	WINDOW *w = CursesOut::initWindow();
 	CursesIn in = { *env.context };
 	CursesOut out = { *env.context, w };
-	return env.context->gameLoop(60, true, onEventCurses, onRender, onDrawCurses, &env);
+	return env.context->simulationLoop(60, 60, onEventCurses, onRender, onDrawCurses, &env);
 }
 
 static void finishCurses(Env &env) {
@@ -285,7 +285,7 @@ static int onEventGdi(void *event, void *data) {
 	return 0;
 }
 
-static void onDrawGdi(void *data) {
+static void onDrawGdi(const float alpha, void *data) {
 	const Env *env = (const Env*) data;
 	Context *context = env->context;
 	const GdiOut *out = (const GdiOut*) context->getFrontendOut();
@@ -293,7 +293,7 @@ static void onDrawGdi(void *data) {
 	const std::pair<int,int> scrDim = out->screenDimension();
 	Box boxScr;
 	for (auto &box : env->boxes) {
-		if (!scaleBox(*box, boxScr, scrDim))
+		if (!scaleBox(*box, boxScr, scrDim, alpha))
 			continue;
 		const int x1 = boxScr.offset.first;
 		const int y1 = boxScr.offset.second;
@@ -305,7 +305,7 @@ static int startGdi(Env &env) {
 	HWND win = GdiOut::initWindow("swfexample");
 	GdiIn in = {*env.context, win};
 	GdiOut out = {*env.context, win};
-	return env.context->gameLoop(60, true, onEventGdi, onRender, onDrawGdi, &env);
+	return env.context->simulationLoop(60, 60, onEventGdi, onRender, onDrawGdi, &env);
 }
 
 static void finishGdi(Env &env) {
@@ -365,7 +365,7 @@ static int onEventSdl1(void *event, void *data) {
 	return 0;
 }
 
-static void onDrawSdl1(void *data) {
+static void onDrawSdl1(const float alpha, void *data) {
 	const Env *env = (const Env*) data;
 	Context *ctx = env->context;
 	const Sdl1Out *out = (const Sdl1Out*) ctx->getFrontendOut();
@@ -376,7 +376,7 @@ static void onDrawSdl1(void *data) {
 	int i = 17;
 	for (auto &box : env->boxes) {
 		i+=31;
-		if (!scaleBox(*box, boxScr, scrDim))
+		if (!scaleBox(*box, boxScr, scrDim, alpha))
 			continue;
 		SDL_Rect r { (Sint16) boxScr.offset.first, (Sint16) boxScr.offset.second, (Uint16) boxScr.dimension.first,
 		    (Uint16) boxScr.dimension.second };
@@ -389,7 +389,7 @@ static int startSdl1(Env &env) {
 	SDL_Surface *scr = Sdl1Out::initSurface();
 	Sdl1In in { *env.context };
 	Sdl1Out out { *env.context, scr };
-	return env.context->gameLoop(60, true, onEventSdl1, onRender, onDrawSdl1, &env);
+	return env.context->simulationLoop(60, 60, onEventSdl1, onRender, onDrawSdl1, &env);
 }
 
 static void finishSdl1(Env &env) {
@@ -445,7 +445,7 @@ static int onEventSdl2(void *event, void *data) {
 	return 0;
 }
 
-static void onDrawSdl2(void *data) {
+static void onDrawSdl2(const float alpha, void *data) {
 	const Env *env = (const Env*) data;
 	Context *ctx = env->context;
 	const Sdl2Out *out = (const Sdl2Out*) ctx->getFrontendOut();
@@ -457,7 +457,7 @@ static void onDrawSdl2(void *data) {
 	int i = 17;
 	for (auto &box : env->boxes) {
 		i+=31;
-		if (!scaleBox(*box, boxScr, scrDim))
+		if (!scaleBox(*box, boxScr, scrDim, alpha))
 			continue;
 		SDL_Rect r { (Sint16) boxScr.offset.first, (Sint16) boxScr.offset.second, (Uint16) boxScr.dimension.first,
 		    (Uint16) boxScr.dimension.second };
@@ -471,7 +471,7 @@ static int startSdl2(Env &env) {
 	SDL_Renderer *rnd = Sdl2Out::initRenderer(win);
 	Sdl2In in { *env.context };
 	Sdl2Out out { *env.context, win, rnd };
-	return env.context->gameLoop(60, true, onEventSdl2, onRender, onDrawSdl2, &env);
+	return env.context->simulationLoop(60, 60, onEventSdl2, onRender, onDrawSdl2, &env);
 }
 
 static void finishSdl2(Env &env) {
@@ -541,7 +541,7 @@ static int onEventXcb(void *event, void *data) {
 	return 0;
 }
 
-static void onDrawXcb(void *data) {
+static void onDrawXcb(const float alpha, void *data) {
 	const Env *env = (const Env*) data;
 	Context *ctx = env->context;
 	const XcbOut *out = (const XcbOut*) ctx->getFrontendOut();
@@ -550,7 +550,7 @@ static void onDrawXcb(void *data) {
 	xcb_poly_fill_rectangle(out->getConnection(), out->getWindow(), out->getGContextInverse(), 1, &rect);
 	Box boxScr;
 	for (auto &box : env->boxes) {
-		if (!scaleBox(*box, boxScr, scrDim))
+		if (!scaleBox(*box, boxScr, scrDim, alpha))
 			continue;
 		rect.x = boxScr.offset.first;
 		rect.y = boxScr.offset.second;
@@ -567,7 +567,7 @@ static int startXcb(Env &env) {
 	xcb_font_t fnt = XcbOut::initFont(cn);
 	XcbIn in { *env.context, cn };
 	XcbOut out { *env.context, cn, scr, win, fnt };
-	return env.context->gameLoop(60, true, onEventXcb, onRender, onDrawXcb, &env);
+	return env.context->simulationLoop(60, 60, onEventXcb, onRender, onDrawXcb, &env);
 }
 
 static void finishXcb(Env &env) {
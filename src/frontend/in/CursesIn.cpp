@@ -17,6 +17,7 @@
 //#include <iostream>
 
 #include <time.h>
+#include <unistd.h>
 
 #include <curses.h>
 
@@ -54,6 +55,14 @@ CursesIn::~CursesIn() {
  * event handling
  */
 
+int CursesIn::eventFd() const {
+	return STDIN_FILENO;
+}
+
+int CursesIn::eventSize(void *event) const {
+	return sizeof(int);
+}
+
 void* CursesIn::eventPoll() {
 	currentEvent = getch();
 	if (currentEvent == ERR)
@@ -61,15 +70,18 @@ void* CursesIn::eventPoll() {
 	return &currentEvent;
 }
 
+// returns nullptr when woken up without input, e.g. by timer or wakeup
 void* CursesIn::eventWait() {
-	currentEvent = getch();
-	if (currentEvent == ERR)
-		return nullptr;
-	return &currentEvent;
+	for (;;) {
+		currentEvent = getch();
+		if (currentEvent != ERR)
+			return &currentEvent;
+		if (!eventBlock())
+			return nullptr;
+	}
 }
 
 void CursesIn::in(void *event) const {
-	((Component*) getContext()->getRootContainer())->invalidatePosition();
 	if (event == nullptr)
 		return;
 	const int c = *(const int*) event;
@@ -86,6 +98,18 @@ void CursesIn::in(void *event) const {
 //		break;
 	case 127:		// DEL (delete)
 		break;
+	case KEY_RESIZE: {	// terminal resized, lay out on the next frame
+		Component *root = (Component*) getContext()->getRootContainer();
+		if (root != nullptr)
+			root->invalidateSize();
+		break;
+	}
+	case KEY_MOUSE: {	// positions are in cells like the screen dimension
+		MEVENT me;
+		if (getmouse(&me) == OK)
+			getContext()->eventClick(me.x, me.y);
+		break;
+	}
 	case KEY_DC:
 		break;
 	case KEY_LEFT:		// cursor left
@@ -114,10 +138,7 @@ void CursesIn::gameLoopSleep() const {
 }
 
 long CursesIn::gameLoopTicks() const {
-	timespec ts;
-	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
-		SWFLOG(getContext(), LOG_WARN, "clock gettime error");
-	return 1000L * ts.tv_sec + ts.tv_nsec / 1000L / 1000L;
+	return gameLoopNanos() / 1000L / 1000L;
 }
 
 
@@ -135,6 +156,7 @@ WINDOW* CursesIn::initWindow() {
 	nonl();
 	intrflush(w, FALSE);
 	keypad(w, TRUE);
+	mousemask(BUTTON1_PRESSED, nullptr);
 	meta(w, TRUE);
 	raw();
 	scrollok(w, FALSE);
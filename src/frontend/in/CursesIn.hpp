@@ -35,6 +35,8 @@ public:
 	~CursesIn();
 
 	// event handling
+	int eventFd() const override;
+	int eventSize(void*) const override;
 	void* eventPoll() override;
 	void* eventWait() override;
 	void in(void*) const override;
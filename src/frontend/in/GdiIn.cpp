@@ -64,6 +64,10 @@ HWND GdiIn::getWindow() const {
  * event handling
  */
 
+int GdiIn::eventSize(void *event) const {
+	return sizeof(MSG);
+}
+
 void* GdiIn::eventPoll() {
 	if (!PeekMessage(&currentEvent, window, 0, 0, PM_REMOVE))
 		return nullptr;
@@ -96,6 +100,7 @@ void GdiIn::in(void *event) const {
 		break;
 	case WM_LBUTTONDOWN:
 		SWFLOG(getContext(), LOG_DEBUG, "click %dx%d", GET_X_LPARAM(e->lParam), GET_Y_LPARAM(e->lParam));
+		getContext()->eventClick(GET_X_LPARAM(e->lParam), GET_Y_LPARAM(e->lParam));
 		break;
 	case WM_MOUSEMOVE:
 //		SWFLOG(getContext(), LOG_DEBUG, "move %dx%d", GET_X_LPARAM(e->lParam), GET_Y_LPARAM(e->lParam));
@@ -42,6 +42,7 @@ public:
 	HWND getWindow() const;
 
 	// event handling
+	int eventSize(void*) const override;
 	void* eventPoll() override;
 	void* eventWait() override;
 	void in(void*) const override;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <time.h>
+
+#include "NullIn.hpp"
+
+#include "../../core/Context.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "NULL_IN";
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+NullIn::NullIn(Context &ctx) : FrontendIn(ctx) {
+	currentEvent = 0;
+}
+
+NullIn::~NullIn() {
+	SWFLOG(getContext(), LOG_INFO, nullptr);
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+
+/*
+ * ******************************************************** public
+ */
+
+
+/*
+ * event handling
+ */
+
+// queues an event for the next poll, call from the loop thread or via Context::invoke
+void NullIn::eventPush(const int event) {
+	events.push_back(event);
+}
+
+int NullIn::eventSize(void *event) const {
+	return sizeof(int);
+}
+
+void* NullIn::eventPoll() {
+	if (events.empty())
+		return nullptr;
+	currentEvent = events.front();
+	events.pop_front();
+	return &currentEvent;
+}
+
+// returns nullptr when woken up without input, e.g. by timer or wakeup
+void* NullIn::eventWait() {
+	void *e = eventPoll();
+	if (e != nullptr)
+		return e;
+	eventBlock();
+	return eventPoll();
+}
+
+void NullIn::in(void *event) const {
+}
+
+
+/*
+ * game loop
+ */
+
+void NullIn::gameLoopSleep() const {
+	timespec ts;
+	ts.tv_sec = 0;
+	ts.tv_nsec = 1000 * 1000;
+	nanosleep(&ts, NULL);
+}
+
+long NullIn::gameLoopTicks() const {
+	return gameLoopNanos() / 1000L / 1000L;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "RecordIn.hpp"
+
+#include "../../core/Context.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "RECORD_IN";
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+// registers itself as the frontend of the context in place of the wrapped one
+RecordIn::RecordIn(Context &ctx, FrontendIn *in, const char *path) : FrontendIn(ctx) {
+	frontend = in;
+	events = 0;
+	isSizeWarned = false;
+	ticksStart = frontend->gameLoopTicks();
+	file = std::fopen(path, "wb");
+	if (file == nullptr) {
+		SWFLOG(getContext(), LOG_WARN, "cannot open %s", path);
+		return;
+	}
+	std::fwrite(recordMagic, sizeof(recordMagic), 1, file);
+	std::fwrite(&recordVersion, sizeof(recordVersion), 1, file);
+}
+
+RecordIn::~RecordIn() {
+	SWFLOG(getContext(), LOG_INFO, "%ld events", events);
+	if (file != nullptr)
+		std::fclose(file);
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+void RecordIn::record(void *event) {
+	if (event == nullptr || file == nullptr)
+		return;
+	const uint32_t size = frontend->eventSize(event);
+	if (size == 0) {
+		if (!isSizeWarned)
+			SWFLOG(getContext(), LOG_WARN, "frontend events have no size, not recorded");
+		isSizeWarned = true;
+		return;
+	}
+	const int64_t ticks = frontend->gameLoopTicks() - ticksStart;
+	std::fwrite(&ticks, sizeof(ticks), 1, file);
+	std::fwrite(&size, sizeof(size), 1, file);
+	std::fwrite(event, size, 1, file);
+	events++;
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+
+/*
+ * getter
+ */
+
+bool RecordIn::isOpen() const {
+	return file != nullptr;
+}
+
+long RecordIn::getEventCount() const {
+	return events;
+}
+
+
+/*
+ * event handling
+ */
+
+void RecordIn::eventFree(void *event) {
+	frontend->eventFree(event);
+}
+
+int RecordIn::eventFd() const {
+	return frontend->eventFd();
+}
+
+int RecordIn::eventSize(void *event) const {
+	return frontend->eventSize(event);
+}
+
+void* RecordIn::eventPoll() {
+	void *e = frontend->eventPoll();
+	record(e);
+	return e;
+}
+
+void* RecordIn::eventWait() {
+	void *e = frontend->eventWait();
+	record(e);
+	return e;
+}
+
+// the wrapped frontend is the one blocking
+void RecordIn::eventWakeup() {
+	frontend->eventWakeup();
+}
+
+void RecordIn::in(void *event) const {
+	frontend->in(event);
+}
+
+
+/*
+ * game loop
+ */
+
+void RecordIn::gameLoopSleep() const {
+	frontend->gameLoopSleep();
+}
+
+void RecordIn::gameLoopSleepUntil(const long long deadline) const {
+	frontend->gameLoopSleepUntil(deadline);
+}
+
+long RecordIn::gameLoopTicks() const {
+	return frontend->gameLoopTicks();
+}
+
+long long RecordIn::gameLoopNanos() const {
+	return frontend->gameLoopNanos();
+}
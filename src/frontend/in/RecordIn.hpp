@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_FRONTEND_IN_RECORD
+#define SWF_FRONTEND_IN_RECORD
+
+#include <cstdint>
+#include <cstdio>
+
+#include "../../core/FrontendIn.hpp"
+
+class Component;
+
+// file layout in native byte order: magic "SWFR", uint32 version, then per event an
+// int64 ticks since the start of the recording, a uint32 size and the event bytes
+static const char recordMagic[4] { 'S', 'W', 'F', 'R' };
+static const uint32_t recordVersion = 1;
+
+
+// wraps the frontend of a backend and writes every event it delivers to a file,
+// everything else is passed through
+class RecordIn : public FrontendIn {
+
+private:
+	FrontendIn *frontend;
+	std::FILE *file;
+	long ticksStart;
+	long events;
+	bool isSizeWarned;
+	void record(void*);
+
+public:
+	RecordIn(Context&, FrontendIn*, const char*);
+	~RecordIn();
+
+	// getter
+	bool isOpen() const;
+	long getEventCount() const;
+
+	// event handling
+	void eventFree(void*) override;
+	int eventFd() const override;
+	int eventSize(void*) const override;
+	void* eventPoll() override;
+	void* eventWait() override;
+	void eventWakeup() override;
+	void in(void*) const override;
+
+	// game loop
+	void gameLoopSleep() const override;
+	void gameLoopSleepUntil(const long long) const override;
+	long gameLoopTicks() const override;
+	long long gameLoopNanos() const override;
+
+};
+
+#endif // SWF_FRONTEND_IN_RECORD
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "ReplayIn.hpp"
+#include "RecordIn.hpp"
+
+#include "../../core/Context.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "REPLAY_IN";
+
+static const std::size_t headerSize = sizeof(recordMagic) + sizeof(recordVersion);
+static const std::size_t eventHeaderSize = sizeof(int64_t) + sizeof(uint32_t);
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+// registers itself as the frontend of the context in place of the wrapped one
+ReplayIn::ReplayIn(Context &ctx, FrontendIn *in, const char *path) : FrontendIn(ctx) {
+	frontend = in;
+	stepNanos = 0;
+	if (!load(path))
+		data.clear();
+	rewind();
+}
+
+ReplayIn::~ReplayIn() {
+	SWFLOG(getContext(), LOG_INFO, nullptr);
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// reads and validates the whole recording
+bool ReplayIn::load(const char *path) {
+	std::FILE *f = std::fopen(path, "rb");
+	if (f == nullptr) {
+		SWFLOG(getContext(), LOG_WARN, "cannot open %s", path);
+		return false;
+	}
+	char buf[4096];
+	std::size_t n;
+	while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0)
+		data.insert(data.end(), buf, buf + n);
+	std::fclose(f);
+
+	uint32_t version = 0;
+	if (data.size() >= headerSize)
+		std::memcpy(&version, &data[sizeof(recordMagic)], sizeof(version));
+	if (data.size() < headerSize || std::memcmp(&data[0], recordMagic, sizeof(recordMagic)) != 0
+	    || version != recordVersion) {
+		SWFLOG(getContext(), LOG_WARN, "%s is no recording of version %u", path, recordVersion);
+		return false;
+	}
+	for (std::size_t i = headerSize; i < data.size();) {
+		uint32_t size;
+		if (data.size() - i < eventHeaderSize) {
+			SWFLOG(getContext(), LOG_WARN, "%s truncated at %zu", path, i);
+			return false;
+		}
+		std::memcpy(&size, &data[i + sizeof(int64_t)], sizeof(size));
+		i += eventHeaderSize;
+		if (data.size() - i < size) {
+			SWFLOG(getContext(), LOG_WARN, "%s truncated at %zu", path, i);
+			return false;
+		}
+		i += size;
+	}
+	return true;
+}
+
+long long ReplayIn::eventNanos() const {
+	int64_t ticks;
+	std::memcpy(&ticks, &data[offset], sizeof(ticks));
+	return ticks * 1000LL * 1000LL;
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+
+/*
+ * getter / setter
+ */
+
+bool ReplayIn::isFinished() const {
+	return offset >= data.size();
+}
+
+// events delivered since the last rewind
+long ReplayIn::getEventCount() const {
+	return events;
+}
+
+// lets a loop that never sleeps make progress, 0 by default
+void ReplayIn::setStepNanos(const long long step) {
+	stepNanos = step;
+}
+
+// starts over with the first event and the virtual clock at 0
+void ReplayIn::rewind() {
+	offset = data.empty() ? 0 : headerSize;
+	events = 0;
+	nanos = 0;
+}
+
+
+/*
+ * event handling
+ */
+
+int ReplayIn::eventSize(void *event) const {
+	return frontend->eventSize(event);
+}
+
+// delivers the next event once the virtual clock reached its time
+void* ReplayIn::eventPoll() {
+	if (isFinished() || eventNanos() > nanos)
+		return nullptr;
+	uint32_t size;
+	std::memcpy(&size, &data[offset + sizeof(int64_t)], sizeof(size));
+	offset += eventHeaderSize;
+	currentEvent.resize(size / sizeof(std::max_align_t) + 1);
+	std::memcpy(currentEvent.data(), &data[offset], size);
+	offset += size;
+	events++;
+	return currentEvent.data();
+}
+
+// jumps the virtual clock to the next event, returns null when finished
+void* ReplayIn::eventWait() {
+	if (isFinished())
+		return nullptr;
+	const long long next = eventNanos();
+	if (next > nanos)
+		nanos = next;
+	return eventPoll();
+}
+
+bool ReplayIn::isEventEnd() const {
+	return isFinished();
+}
+
+void ReplayIn::in(void *event) const {
+	frontend->in(event);
+}
+
+
+/*
+ * game loop
+ */
+
+void ReplayIn::gameLoopSleep() const {
+	nanos += 1000LL * 1000LL;
+}
+
+void ReplayIn::gameLoopSleepUntil(const long long deadline) const {
+	if (nanos < deadline)
+		nanos = deadline;
+}
+
+long ReplayIn::gameLoopTicks() const {
+	return nanos / 1000LL / 1000LL;
+}
+
+long long ReplayIn::gameLoopNanos() const {
+	nanos += stepNanos;
+	return nanos;
+}
+
+long long ReplayIn::measureNanos() const {
+	return frontend->measureNanos();
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_FRONTEND_IN_REPLAY
+#define SWF_FRONTEND_IN_REPLAY
+
+#include <cstddef>
+#include <vector>
+
+#include "../../core/FrontendIn.hpp"
+
+class Component;
+
+
+// feeds the events of a RecordIn file to the wrapped frontend on a virtual clock,
+// the clock advances only when the loop sleeps or waits, so every run of a
+// recording handles the same events in the same frames; statistics are measured
+// on the clock of the wrapped frontend
+class ReplayIn : public FrontendIn {
+
+private:
+	FrontendIn *frontend;
+	std::vector<char> data;		// whole recording
+	std::size_t offset;		// next event record
+	long events;
+	std::vector<std::max_align_t> currentEvent;	// aligned copy of the event
+	mutable long long nanos;	// virtual clock, starts at 0 with the recording
+	long long stepNanos;		// virtual nanos per gameLoopNanos call
+	bool load(const char*);
+	long long eventNanos() const;
+
+public:
+	ReplayIn(Context&, FrontendIn*, const char*);
+	~ReplayIn();
+
+	// getter / setter
+	bool isFinished() const;
+	long getEventCount() const;
+	void setStepNanos(const long long);
+	void rewind();
+
+	// event handling
+	int eventSize(void*) const override;
+	void* eventPoll() override;
+	void* eventWait() override;
+	bool isEventEnd() const override;
+	void in(void*) const override;
+
+	// game loop
+	void gameLoopSleep() const override;
+	void gameLoopSleepUntil(const long long) const override;
+	long gameLoopTicks() const override;
+	long long gameLoopNanos() const override;
+	long long measureNanos() const override;
+
+};
+
+#endif // SWF_FRONTEND_IN_REPLAY
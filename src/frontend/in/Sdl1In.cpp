@@ -55,6 +55,10 @@ Sdl1In::~Sdl1In() {
  * event handling
  */
 
+int Sdl1In::eventSize(void *event) const {
+	return sizeof(SDL_Event);
+}
+
 void* Sdl1In::eventPoll() {
 	const int i = SDL_PollEvent(&currentEvent);
 	if (!i)
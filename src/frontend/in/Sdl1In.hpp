@@ -36,6 +36,7 @@ public:
 	~Sdl1In();
 
 	// event handling
+	int eventSize(void*) const override;
 	void* eventPoll() override;
 	void* eventWait() override;
 	void in(void*) const override;
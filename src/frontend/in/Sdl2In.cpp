@@ -63,6 +63,10 @@ Sdl2In::~Sdl2In() {
  * event handling
  */
 
+int Sdl2In::eventSize(void *event) const {
+	return sizeof(SDL_Event);
+}
+
 void* Sdl2In::eventPoll() {
 	const int i = SDL_PollEvent(&currentEvent);
 	if (!i)
@@ -79,6 +83,14 @@ void* Sdl2In::eventWait() {
 	return &currentEvent;
 }
 
+// sdl has no descriptor to block on, SDL_WaitEvent returns on a pushed user event
+void Sdl2In::eventWakeup() {
+	SDL_Event e {};
+	e.type = SDL_USEREVENT;
+	if (SDL_PushEvent(&e) < 0)
+		SWFLOG(getContext(), LOG_WARN, "sdl push event error: %s", SDL_GetError());
+}
+
 void Sdl2In::in(void *event) const {
 	if (event == nullptr)
 		return;
@@ -99,6 +111,15 @@ void Sdl2In::in(void *event) const {
 		break;
 	case SDL_MOUSEBUTTONDOWN:
 		SWFLOG(getContext(), LOG_DEBUG, "click %dx%d", e->button.x, e->button.y);
+		getContext()->eventClick(e->button.x, e->button.y);
+		break;
+	case SDL_WINDOWEVENT:
+		if (e->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+			SWFLOG(getContext(), LOG_DEBUG, "resize %dx%d", e->window.data1, e->window.data2);
+			Component *root = (Component*) getContext()->getRootContainer();
+			if (root != nullptr)
+				root->invalidateSize();
+		}
 		break;
 	case SDL_MOUSEMOTION:
 		//SWFLOG(getContext(), LOG_DEBUG, "move %dx%d", e->motion.x, e->motion.y);
@@ -116,6 +137,26 @@ void Sdl2In::gameLoopSleep() const {
 	SDL_Delay(1);	
 }
 
+// SDL_Delay has millisecond granularity, sleep all but the last millisecond and spin the rest
+void Sdl2In::gameLoopSleepUntil(const long long deadline) const {
+	const long long remaining = (deadline - gameLoopNanos()) / 1000LL / 1000LL;
+	if (remaining > 1)
+		SDL_Delay((Uint32) (remaining - 1));
+	while (gameLoopNanos() < deadline)
+		;
+}
+
 long Sdl2In::gameLoopTicks() const {
 	return SDL_GetTicks();
 }
+
+// performance counter has a different epoch than SDL_GetTicks, rebase it on first use
+long long Sdl2In::gameLoopNanos() const {
+	static const Uint64 frequency = SDL_GetPerformanceFrequency();
+	static const Uint64 counterStart = SDL_GetPerformanceCounter();
+	static const long long ticksStart = SDL_GetTicks();
+	const Uint64 counter = SDL_GetPerformanceCounter() - counterStart;
+	const long long seconds = (long long) (counter / frequency);
+	const long long fraction = (long long) (counter % frequency * 1000000000ULL / frequency);
+	return ticksStart * 1000LL * 1000LL + seconds * 1000LL * 1000LL * 1000LL + fraction;
+}
@@ -36,13 +36,17 @@ public:
 	~Sdl2In();
 
 	// event handling
+	int eventSize(void*) const override;
 	void* eventPoll() override;
 	void* eventWait() override;
+	void eventWakeup() override;
 	void in(void*) const override;
 
 	// game loop
 	void gameLoopSleep() const override;
+	void gameLoopSleepUntil(const long long) const override;
 	long gameLoopTicks() const override;
+	long long gameLoopNanos() const override;
 
 };
 
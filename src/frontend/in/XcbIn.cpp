@@ -34,6 +34,8 @@ static const std::basic_string<char> LOG_FACILITY = "XCB_IN";
 
 XcbIn::XcbIn(Context &ctx, xcb_connection_t* cn) : FrontendIn(ctx) {
 	connection = cn;
+	windowWidth = -1;
+	windowHeight = -1;
 }
 
 XcbIn::~XcbIn() {
@@ -68,12 +70,33 @@ void XcbIn::eventFree(void *event) {
 	free(event);
 }
 
+int XcbIn::eventFd() const {
+	return xcb_get_file_descriptor(connection);
+}
+
+int XcbIn::eventSize(void *event) const {
+	return sizeof(xcb_generic_event_t);
+}
+
 void* XcbIn::eventPoll() {
 	return xcb_poll_for_event(connection);
 }
 
+// returns nullptr when woken up without input, e.g. by timer or wakeup
 void* XcbIn::eventWait() {
-	return xcb_poll_for_event(connection);
+	for (;;) {
+		// polling also empties the queue xcb has already read from the socket
+		void *e = xcb_poll_for_event(connection);
+		if (e != nullptr)
+			return e;
+		if (xcb_connection_has_error(connection)) {
+			SWFLOG(getContext(), LOG_WARN, "xcb connection error");
+			return nullptr;
+		}
+		xcb_flush(connection);
+		if (!eventBlock())
+			return nullptr;
+	}
 }
 
 void XcbIn::in(void *event) const {
@@ -84,12 +107,24 @@ void XcbIn::in(void *event) const {
 	case XCB_EXPOSE: {
 		xcb_expose_event_t *ee = (xcb_expose_event_t *) event;
 		SWFLOG(getContext(), LOG_DEBUG, "expose");
-		((Component*)getContext()->getRootContainer())->invalidatePosition();
+		break;
+	}
+	case XCB_CONFIGURE_NOTIFY: {
+		const xcb_configure_notify_event_t *cne = (const xcb_configure_notify_event_t*) event;
+		SWFLOG(getContext(), LOG_DEBUG, "configure %dx%d", cne->width, cne->height);
+		if (cne->width == windowWidth && cne->height == windowHeight)
+			break;
+		windowWidth = cne->width;
+		windowHeight = cne->height;
+		Component *root = (Component*) getContext()->getRootContainer();
+		if (root != nullptr)
+			root->invalidateSize();
 		break;
 	}
 	case XCB_BUTTON_PRESS: {
 		xcb_button_press_event_t *bpe = (xcb_button_press_event_t*) event;
 		SWFLOG(getContext(), LOG_DEBUG, "button %dx%d", bpe->event_x, bpe->event_y);
+		getContext()->eventClick(bpe->event_x, bpe->event_y);
 		break;
 	}
 	case XCB_KEY_PRESS: {
@@ -120,10 +155,7 @@ void XcbIn::gameLoopSleep() const {
 }
 
 long XcbIn::gameLoopTicks() const {
-	timespec ts;
-	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
-		SWFLOG(getContext(), LOG_WARN, "clock gettime error");
-	return 1000L * ts.tv_sec + ts.tv_nsec / 1000L / 1000L;
+	return gameLoopNanos() / 1000L / 1000L;
 }
 
 
@@ -191,7 +223,8 @@ xcb_window_t DisplayXcb::initWindow(xcb_connection_t *cn, xcb_screen_t *scr, con
 
 	xcb_window_t win = xcb_generate_id(cn);
 	const uint32_t valueListWindow[] { scr->white_pixel,
-	    XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS };
+	    XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS |
+	    XCB_EVENT_MASK_STRUCTURE_NOTIFY };
 	xcb_create_window(cn, XCB_COPY_FROM_PARENT, win,
 	    scr->root, off.first, off.second, dim.first, dim.second, 0,
 	    XCB_WINDOW_CLASS_INPUT_OUTPUT, scr->root_visual,
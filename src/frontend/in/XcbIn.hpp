@@ -29,6 +29,8 @@ class XcbIn : public FrontendIn {
 
 private:
 	xcb_connection_t *connection;
+	mutable int windowWidth;	// last configured size, moves and restacking keep it
+	mutable int windowHeight;
 
 public:
 	XcbIn(Context&, xcb_connection_t*);
@@ -39,6 +41,8 @@ public:
 
 	// event handling
 	void eventFree(void*) override;
+	int eventFd() const override;
+	int eventSize(void*) const override;
 	void* eventPoll() override;
 	void* eventWait() override;
 	void in(void*) const override;
@@ -22,6 +22,7 @@
 
 //#include "Component.hpp"
 #include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "CURSES_OUT";
@@ -55,6 +56,7 @@ CursesOut::~CursesOut() {
  */
 
 void CursesOut::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("CursesOut::draw");
 	if ((int) text.length() > pos.w) {
 		auto s = text.substr(0, pos.w);
 		mvaddstr(pos.textY, pos.textX, s.c_str());
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <bitset>
+#include <cmath>
+
+#include "FontPanel.hpp"
+
+#include "../../core/Context.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "FONT_PANEL";
+
+
+/*
+ * ******************************************************** constructor
+ */
+
+// empty panel, dimensions of a common 8x16 terminal font until built
+FontPanel::FontPanel() {
+	width = 0;
+	height = 16;
+	widthAvg = 8;
+	for (int i = 0; i < charCount; i++)
+		offsets[i] = 0;
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+// copies a glyph into the coverage strip, mono bitmaps are unpacked to 0 or 0xff
+void FontPanel::drawGlyph(std::vector<uint8_t> &panel, const int pitch, const FT_GlyphSlot glyph,
+	    const int offsetX, const int ascender) {
+	const FT_Bitmap bitmap = glyph->bitmap;
+	const int rows = panel.size() / pitch;
+	const int baseX = offsetX + glyph->bitmap_left;
+	const int baseY = (ascender > 0 ? ascender : glyph->bitmap_top) - glyph->bitmap_top;
+	for (int y = 0; y < (int) bitmap.rows; y++) {
+		const int py = baseY + y;
+		if (py < 0 || py >= rows)
+			continue;
+		const unsigned char *row = bitmap.buffer + y * bitmap.pitch;
+		for (int x = 0; x < (int) bitmap.width; x++) {
+			const int px = baseX + x;
+			if (px < 0 || px >= pitch)
+				continue;
+			uint8_t c;
+			if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+				const std::bitset<8> bits = { (unsigned long long) row[x / 8] };
+				c = bits[7 - x % 8] ? 0xff : 0;
+			} else {
+				c = row[x];
+			}
+			panel[py * pitch + px] = c;
+		}
+	}
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+// picks the bitmap size nearest to a hundredth of the screen height and renders the
+// panel chars, the face stays with the caller and is not needed afterwards
+bool FontPanel::build(Context &ctx, FT_Face face, const int screenHeight) {
+	int targetFontSize = screenHeight / 100;
+	if (targetFontSize < 8)
+		targetFontSize = 8;
+	int size = 0;
+	int error;
+	if (face->available_sizes != NULL && face->num_fixed_sizes > 0) {
+		int i = 0;
+		for (; i < face->num_fixed_sizes; i++) {
+			size = face->available_sizes[i].height;
+			if (size >= targetFontSize)
+				break;
+		}
+		if (i == face->num_fixed_sizes)
+			i--;
+		error = FT_Select_Size(face, i);
+		if (error)
+			SWFLOG(&ctx, LOG_WARN, "freetype select size error: %d", error);
+	} else {
+		size = targetFontSize;
+		error = FT_Set_Pixel_Sizes(face, 0, size);
+		if (error)
+			SWFLOG(&ctx, LOG_WARN, "freetype set pixel sizes error: %d", error);
+	}
+
+	// determine offsets
+	int lastXOffset = 0;
+	for (int i = 0; i < charCount; i++) {
+		error = FT_Load_Char(face, firstChar + i, FT_LOAD_RENDER);
+		if (!error)
+			lastXOffset += std::lround(face->glyph->metrics.horiAdvance / 64.0);
+		offsets[i] = lastXOffset;
+	}
+	if (lastXOffset == 0 || size == 0) {
+		SWFLOG(&ctx, LOG_WARN, "cannot determine font size");
+		return false;
+	}
+	height = size;
+	width = lastXOffset;
+	widthAvg = width / charCount;
+
+	// populate
+	const int ascender = std::lround(face->size->metrics.ascender / 64.0);
+	coverage.assign((std::size_t) width * height, 0);
+	for (int i = 0; i < charCount; i++) {
+		error = FT_Load_Char(face, firstChar + i, FT_LOAD_RENDER);
+		if (error) {
+			SWFLOG(&ctx, LOG_WARN, "freetype load char error: %d", error);
+			continue;
+		}
+		drawGlyph(coverage, width, face->glyph, getCharX(i), ascender);
+	}
+	SWFLOG(&ctx, LOG_INFO, "font: %s, height: %d", face->family_name, height);
+	return true;
+}
+
+
+/*
+ * getter
+ */
+
+bool FontPanel::isEmpty() const {
+	return coverage.empty();
+}
+
+bool FontPanel::isChar(const int c) const {
+	return c >= firstChar && c <= lastChar;
+}
+
+// row major, width bytes per row
+const uint8_t* FontPanel::getCoverage() const {
+	return coverage.data();
+}
+
+int FontPanel::getWidth() const {
+	return width;
+}
+
+int FontPanel::getHeight() const {
+	return height;
+}
+
+int FontPanel::getWidthAvg() const {
+	return widthAvg;
+}
+
+// by char index, not by char
+int FontPanel::getCharX(const int idx) const {
+	return idx > 0 ? offsets[idx-1] : 0;
+}
+
+int FontPanel::getCharWidth(const int idx) const {
+	return offsets[idx] - getCharX(idx);
+}
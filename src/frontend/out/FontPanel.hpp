@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_FRONTEND_OUT_FONT_PANEL
+#define SWF_FRONTEND_OUT_FONT_PANEL
+
+#include <cstdint>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+class Context;
+
+
+// often used chars rendered once into one coverage strip, a byte per pixel, the
+// frontends blit or blend from it, shared by Sdl2Out and RasterOut
+class FontPanel {
+
+public:
+	static const int firstChar = 0x20;		// first char: space
+	static const int lastChar = 0x7e;		// last char: tilde
+	static const int charCount = lastChar - firstChar + 1;
+
+private:
+	std::vector<uint8_t> coverage;
+	int width;
+	int height;
+	int widthAvg;
+	int offsets[charCount];		// end column of every char
+	static void drawGlyph(std::vector<uint8_t>&, const int, const FT_GlyphSlot, const int, const int);
+
+public:
+	FontPanel();
+
+	bool build(Context&, FT_Face, const int);
+
+	// getter
+	bool isEmpty() const;
+	bool isChar(const int) const;
+	const uint8_t* getCoverage() const;
+	int getWidth() const;
+	int getHeight() const;
+	int getWidthAvg() const;
+	int getCharX(const int) const;
+	int getCharWidth(const int) const;
+
+};
+
+#endif // SWF_FRONTEND_OUT_FONT_PANEL
@@ -21,6 +21,7 @@
 #include "GdiOut.hpp"
 
 #include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "GDI_OUT";
@@ -79,6 +80,7 @@ HDC GdiOut::getWindowContext() const {
  */
 
 void GdiOut::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("GdiOut::draw");
 	TextOut(windowContext, pos.textX, pos.textY, text.c_str(), text.length()); 
 }
 
@@ -128,9 +130,9 @@ HWND GdiOut::initWindow(const char *name) {
 }
 
 const static std::size_t bufSize = 1000;
-static char buf[bufSize];
 
 int GdiOut::messageBox(const int error, const char *format...) {
+	char buf[bufSize];
 	std::basic_string<char> s;
 	if (format != nullptr) {
 		va_list arg;
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "NullOut.hpp"
+
+#include "../../core/Container.hpp"
+#include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "NULL_OUT";
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+NullOut::NullOut(Context &ctx, const std::pair<int,int> &screen, const std::pair<int,int> &font) :
+	    FrontendOut(ctx) {
+	screenDim = screen;
+	fontDim = font;
+	draws = 0;
+	bytes = 0;
+	presents = 0;
+}
+
+NullOut::~NullOut() {
+	SWFLOG(getContext(), LOG_INFO, nullptr);
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+void NullOut::invalidate() {
+	Component *root = (Component*) getContext()->getRootContainer();
+	if (root != nullptr)
+		root->invalidateSize();
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+
+/*
+ * getter / setter
+ */
+
+void NullOut::setScreenDimension(const std::pair<int,int> &screen) {
+	screenDim = screen;
+	invalidate();
+}
+
+void NullOut::setFontDimension(const std::pair<int,int> &font) {
+	fontDim = font;
+	getContext()->measureInvalidate();
+	invalidate();
+}
+
+long NullOut::getDrawCount() const {
+	return draws;
+}
+
+long long NullOut::getByteCount() const {
+	return bytes;
+}
+
+long NullOut::getPresentCount() const {
+	return presents;
+}
+
+void NullOut::resetCount() {
+	draws = 0;
+	bytes = 0;
+	presents = 0;
+}
+
+
+/*
+ * drawing
+ */
+
+void NullOut::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("NullOut::draw");
+	draws++;
+	bytes += text.size();
+}
+
+std::pair<int,int> NullOut::screenDimension() const {
+	return screenDim;
+}
+
+std::pair<int,int> NullOut::fontDimension() const {
+	return fontDim;
+}
+
+void NullOut::gameLoopDrawFinish() const {
+	presents++;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_FRONTEND_OUT_NULL
+#define SWF_FRONTEND_OUT_NULL
+
+#include <string>
+#include <utility>
+
+#include "../../core/FrontendOut.hpp"
+
+class Component;
+
+
+// headless output for benchmarks and tests, counts what would have been drawn
+class NullOut : public FrontendOut {
+
+private:
+	std::pair<int,int> screenDim;
+	std::pair<int,int> fontDim;
+
+	// counters
+	mutable long draws;
+	mutable long long bytes;
+	mutable long presents;
+
+	void invalidate();		// layout depends on the dimensions
+
+public:
+	NullOut(Context&, const std::pair<int,int>&, const std::pair<int,int>&);
+	~NullOut();
+
+	// getter / setter
+	void setScreenDimension(const std::pair<int,int>&);
+	void setFontDimension(const std::pair<int,int>&);
+	long getDrawCount() const;
+	long long getByteCount() const;
+	long getPresentCount() const;
+	void resetCount();
+
+	// drawing
+	void draw(const Position&, const Style&, const std::basic_string<char>&) const override;
+	std::pair<int,int> screenDimension() const override;
+	std::pair<int,int> fontDimension() const override;
+	void gameLoopDrawFinish() const override;
+
+};
+
+#endif // SWF_FRONTEND_OUT_NULL
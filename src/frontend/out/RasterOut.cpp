@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "RasterOut.hpp"
+
+#include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
+
+
+static const std::basic_string<char> LOG_FACILITY = "RASTER_OUT";
+
+static const uint32_t colorBackground = 0xff646464;
+static const uint32_t colorText = 0xffffffff;
+
+
+/*
+ * ******************************************************** constructor / destructor
+ */
+
+// a null font path loads term14.pcf.gz from the working directory like Sdl2Out
+RasterOut::RasterOut(Context &ctx, const int w, const int h, const char *fontPath) : FrontendOut(ctx) {
+	width = w > 0 ? w : 1;
+	height = h > 0 ? h : 1;
+	pixels.assign((std::size_t) width * height, 0xff000000);
+	frames = 0;
+	if (!fontInit(fontPath != nullptr ? fontPath : "term14.pcf.gz"))
+		SWFLOG(getContext(), LOG_WARN, "no font, drawing backgrounds only");
+}
+
+RasterOut::~RasterOut() {
+	SWFLOG(getContext(), LOG_INFO, "%ld frames", frames);
+}
+
+
+/*
+ * ******************************************************** private
+ */
+
+
+/*
+ * font
+ */
+
+// the face is only needed to build the panel
+bool RasterOut::fontInit(const char *path) {
+	FT_Library library;
+	FT_Face face;
+	int error = FT_Init_FreeType(&library);
+	if (error) {
+		SWFLOG(getContext(), LOG_WARN, "freetype init error: %d", error);
+		return false;
+	}
+	error = FT_New_Face(library, path, 0, &face);
+	if (error) {
+		SWFLOG(getContext(), LOG_WARN, "freetype new face %s error: %d", path, error);
+		FT_Done_FreeType(library);
+		return false;
+	}
+	const bool isBuilt = fontPanel.build(*getContext(), face, height);
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+	return isBuilt;
+}
+
+
+/*
+ * drawing
+ */
+
+// clipped to the framebuffer
+void RasterOut::fillRect(int x, int y, int w, int h, const uint32_t color) const {
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (x + w > width)
+		w = width - x;
+	if (y + h > height)
+		h = height - y;
+	if (w <= 0 || h <= 0)
+		return;
+	for (int j = y; j < y + h; j++) {
+		uint32_t *row = &pixels[(std::size_t) j * width + x];
+		for (int i = 0; i < w; i++)
+			row[i] = color;
+	}
+}
+
+// blends one panel char at x, y, limited to the clip rect and the framebuffer
+void RasterOut::drawChar(const int idx, const int x, const int y, const Position &clip, const uint32_t color) const {
+	const int panelX = fontPanel.getCharX(idx);
+	const int w = fontPanel.getCharWidth(idx);
+	const int panelWidth = fontPanel.getWidth();
+	const int iFirst = std::max(0, std::max(clip.x, 0) - x);
+	const int iLast = std::min(w, std::min(clip.x + clip.w, width) - x);
+	const int jFirst = std::max(0, std::max(clip.y, 0) - y);
+	const int jLast = std::min(fontPanel.getHeight(), std::min(clip.y + clip.h, height) - y);
+	for (int j = jFirst; j < jLast; j++) {
+		const uint8_t *src = &fontPanel.getCoverage()[(std::size_t) j * panelWidth + panelX];
+		uint32_t *row = &pixels[(std::size_t) (y + j) * width];
+		for (int i = iFirst; i < iLast; i++) {
+			const int px = x + i;
+			const uint32_t a = src[i];
+			if (a == 0)
+				continue;
+			if (a == 0xff) {
+				row[px] = color;
+				continue;
+			}
+			// per channel blend of text over the existing pixel
+			const uint32_t d = row[px];
+			uint32_t out = 0xff000000;
+			for (int shift = 0; shift < 24; shift += 8) {
+				const uint32_t dc = (d >> shift) & 0xff;
+				const uint32_t sc = (color >> shift) & 0xff;
+				out |= ((sc * a + dc * (255 - a)) / 255) << shift;
+			}
+			row[px] = out;
+		}
+	}
+}
+
+
+/*
+ * ******************************************************** public
+ */
+
+
+/*
+ * getter
+ */
+
+// row major, width words per row
+const uint32_t* RasterOut::getPixels() const {
+	return pixels.data();
+}
+
+long RasterOut::getFrameCount() const {
+	return frames;
+}
+
+
+/*
+ * snapshots
+ */
+
+void RasterOut::clear(const uint32_t color) const {
+	fillRect(0, 0, width, height, color);
+}
+
+// binary P6, alpha is dropped
+bool RasterOut::dumpPpm(const char *path) const {
+	std::FILE *f = std::fopen(path, "wb");
+	if (f == nullptr) {
+		SWFLOG(getContext(), LOG_WARN, "cannot open %s", path);
+		return false;
+	}
+	std::fprintf(f, "P6\n%d %d\n255\n", width, height);
+	std::vector<uint8_t> row((std::size_t) width * 3);
+	for (int y = 0; y < height; y++) {
+		const uint32_t *src = &pixels[(std::size_t) y * width];
+		for (int x = 0; x < width; x++) {
+			row[x * 3] = src[x] >> 16;
+			row[x * 3 + 1] = src[x] >> 8;
+			row[x * 3 + 2] = src[x];
+		}
+		std::fwrite(row.data(), 1, row.size(), f);
+	}
+	std::fclose(f);
+	return true;
+}
+
+static std::vector<uint32_t> pngCrcTable() {
+	std::vector<uint32_t> table(256);
+	for (uint32_t n = 0; n < 256; n++) {
+		uint32_t c = n;
+		for (int k = 0; k < 8; k++)
+			c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+		table[n] = c;
+	}
+	return table;
+}
+
+static uint32_t pngCrc(uint32_t crc, const uint8_t *data, const std::size_t size) {
+	static const std::vector<uint32_t> table = pngCrcTable();
+	crc = ~crc;
+	for (std::size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void pngPut32(std::vector<uint8_t> &v, const uint32_t n) {
+	v.push_back(n >> 24);
+	v.push_back(n >> 16);
+	v.push_back(n >> 8);
+	v.push_back(n);
+}
+
+static void pngChunk(std::FILE *f, const char *type, const std::vector<uint8_t> &data) {
+	std::vector<uint8_t> chunk;
+	pngPut32(chunk, data.size());
+	chunk.insert(chunk.end(), type, type + 4);
+	chunk.insert(chunk.end(), data.begin(), data.end());
+	pngPut32(chunk, pngCrc(0, &chunk[4], chunk.size() - 4));
+	std::fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+// RGBA with stored (uncompressed) deflate blocks, needs no zlib and is cheap to write
+bool RasterOut::dumpPng(const char *path) const {
+	std::FILE *f = std::fopen(path, "wb");
+	if (f == nullptr) {
+		SWFLOG(getContext(), LOG_WARN, "cannot open %s", path);
+		return false;
+	}
+	static const uint8_t signature[8] { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	std::fwrite(signature, 1, sizeof(signature), f);
+
+	std::vector<uint8_t> header;
+	pngPut32(header, width);
+	pngPut32(header, height);
+	header.insert(header.end(), { 8, 6, 0, 0, 0 });	// 8 bit rgba, deflate, no filter, no interlace
+	pngChunk(f, "IHDR", header);
+
+	// scanlines with filter type none
+	std::vector<uint8_t> raw;
+	raw.reserve((std::size_t) height * (1 + width * 4));
+	for (int y = 0; y < height; y++) {
+		raw.push_back(0);
+		const uint32_t *src = &pixels[(std::size_t) y * width];
+		for (int x = 0; x < width; x++)
+			raw.insert(raw.end(), { (uint8_t) (src[x] >> 16), (uint8_t) (src[x] >> 8), (uint8_t) src[x],
+			    (uint8_t) (src[x] >> 24) });
+	}
+
+	// zlib stream of stored blocks
+	std::vector<uint8_t> data { 0x78, 0x01 };
+	uint32_t a = 1, b = 0;
+	for (std::size_t i = 0; i < raw.size(); i++) {
+		a = (a + raw[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+	std::size_t offset = 0;
+	do {
+		const std::size_t size = raw.size() - offset < 65535 ? raw.size() - offset : 65535;
+		const bool isLast = offset + size == raw.size();
+		data.insert(data.end(), { (uint8_t) isLast, (uint8_t) size, (uint8_t) (size >> 8), (uint8_t) ~size,
+		    (uint8_t) (~size >> 8) });
+		data.insert(data.end(), raw.begin() + offset, raw.begin() + offset + size);
+		offset += size;
+	} while (offset < raw.size());
+	pngPut32(data, (b << 16) | a);
+	pngChunk(f, "IDAT", data);
+	pngChunk(f, "IEND", {});
+	std::fclose(f);
+	return true;
+}
+
+
+/*
+ * drawing
+ */
+
+void RasterOut::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("RasterOut::draw");
+	// fill background
+	fillRect(pos.x, pos.y, pos.w, pos.h, colorBackground);
+	if (fontPanel.isEmpty())
+		return;
+	int x = pos.textX;
+	for (const auto c : text) {
+		if (x >= pos.x + pos.w)
+			break;
+		if (!fontPanel.isChar(c))
+			continue;
+		const int idx = c - FontPanel::firstChar;
+		drawChar(idx, x, pos.textY, pos, colorText);
+		x += fontPanel.getCharWidth(idx);
+	}
+}
+
+std::pair<int,int> RasterOut::screenDimension() const {
+	return { width, height };
+}
+
+std::pair<int,int> RasterOut::fontDimension() const {
+	return { fontPanel.getWidthAvg(), fontPanel.getHeight() };
+}
+
+void RasterOut::gameLoopDrawFinish() const {
+	frames++;
+}
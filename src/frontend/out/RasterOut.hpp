@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Michael Schmiedgen
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef SWF_FRONTEND_OUT_RASTER
+#define SWF_FRONTEND_OUT_RASTER
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FontPanel.hpp"
+
+#include "../../core/FrontendOut.hpp"
+
+
+// rasterizes into a 32 bit framebuffer in memory, pixels are 0xAARRGGBB words
+// (SDL_PIXELFORMAT_ARGB8888), frames can be dumped as PPM or PNG
+class RasterOut : public FrontendOut {
+
+private:
+	int width;
+	int height;
+	mutable std::vector<uint32_t> pixels;
+	mutable long frames;
+
+	// font panel, coverage of the often used chars rendered once
+	FontPanel fontPanel;
+	bool fontInit(const char*);
+
+	// drawing
+	void fillRect(int, int, int, int, const uint32_t) const;
+	void drawChar(const int, const int, const int, const Position&, const uint32_t) const;
+
+public:
+	RasterOut(Context&, const int, const int, const char*);
+	~RasterOut();
+
+	// getter
+	const uint32_t* getPixels() const;
+	long getFrameCount() const;
+
+	// snapshots
+	void clear(const uint32_t) const;
+	bool dumpPpm(const char*) const;
+	bool dumpPng(const char*) const;
+
+	// drawing
+	void draw(const Position&, const Style&, const std::basic_string<char>&) const override;
+	std::pair<int,int> screenDimension() const override;
+	std::pair<int,int> fontDimension() const override;
+	void gameLoopDrawFinish() const override;
+
+};
+
+#endif // SWF_FRONTEND_OUT_RASTER
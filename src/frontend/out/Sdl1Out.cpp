@@ -32,6 +32,7 @@
 #include "Sdl1Out.hpp"
 
 #include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
 
 
 // used in drawLine()
@@ -372,6 +373,7 @@ void DisplaySdl::drawBorder(const std::pair<int,int> &offset, const std::pair<in
 */
 
 void Sdl1Out::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("Sdl1Out::draw");
 
 	SDL_Rect screenRect, fontPanelRect;
 
@@ -14,7 +14,6 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
-#include <bitset>
 #include <cmath>
 #include <iostream>
 #include <utility>
@@ -33,6 +32,7 @@
 
 //#include "Component.hpp"
 #include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
 
 
 // used in drawLine()
@@ -64,65 +64,12 @@ Sdl2Out::Sdl2Out(Context &ctx, SDL_Window *win, SDL_Renderer *rnd) : FrontendOut
 
 	int screenHeight;
 	SDL_GetWindowSize(window, NULL, &screenHeight);
-	int targetFontSize = screenHeight / 100;
-	if (targetFontSize < 8)
-		targetFontSize = 8;
-	fontHeight = 0;
-	fontSize = 0;
-
-	const FT_Bitmap_Size *sizes = fontFace->available_sizes;
-	const FT_Int sizesCount = fontFace->num_fixed_sizes;
-	if (sizes != NULL && sizesCount > 0) {
-		SWFLOG(getContext(), LOG_WARN, "look for bitmap sizes");
-		int fontWidth = 0;
-		for (int i = 0; i < sizesCount; i++) {
-			fontWidth = sizes[i].width;
-			fontHeight = sizes[i].height;
-			fontSize = std::lround(sizes[i].size / 64.0);
-			if (fontHeight >= targetFontSize)
-				break;
-		}
-/*
-		error = FT_Set_Pixel_Sizes(fontFace, fontWidth, fontHeight);
-		if (error) {
-			SWFLOG(getContext(), LOG_WARN, "freetype set pixel sizes error: %d", error);
-			return;
-		}
-*/
-	}
-	if (fontHeight == 0 || fontSize == 0) {
-		SWFLOG(getContext(), LOG_WARN, "cannot determine font size");
+	if (!fontPanelCoverage.build(ctx, fontFace, screenHeight))
 		return;
-	}
-	SWFLOG(getContext(), LOG_WARN, "font: %s, height: %d, size: %d", fontFace->family_name, fontHeight, fontSize);
-
-	// determine font panel offsets
-	int lastXOffset = 0;
-	for (int i = 0; i < fontPanelCharCount; i++) {
-		const char c = fontPanelFirstChar + (char) i;
-		error = FT_Load_Char(fontFace, c, FT_LOAD_RENDER);
-		if (error) {
-			SWFLOG(getContext(), LOG_WARN, "freetype load char error: %d", error);
-			continue;
-		}
-		const FT_GlyphSlot glyph = fontFace->glyph;
-		if (i > 0) 
-			fontPanelOffsets[i-1] = lastXOffset;
-		switch (glyph->format) {
-		case FT_GLYPH_FORMAT_BITMAP:
-			lastXOffset += std::lround(glyph->metrics.horiAdvance / 64.00);
-			break;
-		default:
-			SWFLOG(getContext(), LOG_WARN, "freetype unknown glyph format");
-			return;
-		}
-		if (i == fontPanelCharCount - 1)
-			fontPanelOffsets[fontPanelCharCount-1] = lastXOffset;
-	}
-	const int fontPanelWidth = fontPanelOffsets[fontPanelCharCount-1];
-	fontWidthAvg = fontPanelWidth / fontPanelCharCount;
 
-	// create font panel surface
+	// create font panel surface, covered pixels white on the black color key
+	const int fontPanelWidth = fontPanelCoverage.getWidth();
+	const int fontHeight = fontPanelCoverage.getHeight();
 	SDL_Surface *fontPanelSrf = SDL_CreateRGBSurface(0, fontPanelWidth, fontHeight, 32, 0, 0, 0, 0);
 	if (fontPanelSrf == NULL) {
 		SWFLOG(getContext(), LOG_WARN, "sdl2 create rgb surface error: %s", SDL_GetError());
@@ -136,19 +83,14 @@ Sdl2Out::Sdl2Out(Context &ctx, SDL_Window *win, SDL_Renderer *rnd) : FrontendOut
 		SWFLOG(getContext(), LOG_WARN, "sdl2 set color key error: %s", SDL_GetError());
 
 	// populate font panel
-	for (int i = 0; i < fontPanelCharCount; i++) {
-		const char c = fontPanelFirstChar + i;
-		error = FT_Load_Char(fontFace, c, FT_LOAD_RENDER);
-		if (error) {
-			SWFLOG(getContext(), LOG_WARN, "freetype load char error: %d", error);
-			continue;
-		}
-		int x = 0;
-		if (i > 0)
-			x = fontPanelOffsets[i-1];
-		drawGlyph(fontPanelSrf, fontFace->glyph, x, 0, SDL_MapRGB(fontPanelSrf->format, 0xff, 0xff, 0xff));
-//		drawGlyph(window, fontFace->glyph, x, 200, SDL_MapRGB(fontPanelSrf->format, 255, 255, 0));
-	}
+	const Uint32 white = SDL_MapRGB(fontPanelSrf->format, 0xff, 0xff, 0xff);
+	const uint8_t *coverage = fontPanelCoverage.getCoverage();
+	SDL_LockSurface(fontPanelSrf);
+	for (int y = 0; y < fontHeight; y++)
+		for (int x = 0; x < fontPanelWidth; x++)
+			if (coverage[y * fontPanelWidth + x] != 0)
+				drawPoint(fontPanelSrf, x, y, white);
+	SDL_UnlockSurface(fontPanelSrf);
 
 	// load font panel surface into texture
 	fontPanel = SDL_CreateTextureFromSurface(renderer, fontPanelSrf);
@@ -179,16 +121,13 @@ Sdl2Out::~Sdl2Out() {
  */
 
 bool Sdl2Out::isFontPanelChar(const int c, SDL_Rect *dimension) const {
-	if (c < fontPanelFirstChar || c > fontPanelLastChar)
+	if (!fontPanelCoverage.isChar(c))
 		return false;
-	const int idx = c - fontPanelFirstChar;
-	if (idx == 0)
-		dimension->x = 0;
-	else
-		dimension->x = fontPanelOffsets[idx-1];
+	const int idx = c - FontPanel::firstChar;
+	dimension->x = fontPanelCoverage.getCharX(idx);
 	dimension->y = 0;
-	dimension->w = fontPanelOffsets[idx] - dimension->x;
-	dimension->h = fontHeight;
+	dimension->w = fontPanelCoverage.getCharWidth(idx);
+	dimension->h = fontPanelCoverage.getHeight();
 	return true;
 }
 
@@ -300,40 +239,6 @@ void Sdl2Out::drawLine(SDL_Surface *dst, int x0, int y0, int x1, int y1, const U
 	SDL_UnlockSurface(dst);
 }
 
-void Sdl2Out::drawGlyph(SDL_Surface *dst, const FT_GlyphSlot glyph, const int offsetX, const int offsetY,
-	    const Uint32 color) {
-	const FT_Bitmap bitmap = glyph->bitmap;
-	const int width = bitmap.width;
-	const int height = bitmap.rows;
-
-	const SDL_Rect r = { (Sint16) offsetX, (Sint16) offsetY, (Uint16) width, (Uint16) height };
-	if (SDL_FillRect(dst, &r, 0x00000000) == -1)
-		std::printf("%s drawText() sdl2 fill rect error: %s", LOG_FACILITY.c_str(), SDL_GetError());
-
-	const int baseX = offsetX + std::lround(glyph->metrics.horiBearingX / 64.0);
-	const int baseY = offsetY + glyph->bitmap_top - std::lround(glyph->metrics.horiBearingY / 64.0) - 2;
-	unsigned char *buffer = bitmap.buffer;
-	SDL_LockSurface(dst);
-	for (int y = 0; y < height; y++) {
-		int bufferIndex = y * bitmap.pitch;
-		Uint16 x = 0;
-		while (x < width) {
-			const unsigned char c = buffer[bufferIndex];
-			const std::bitset<8> bits = { (const unsigned long long) c };
-			for (size_t i = 0; i < bits.size() && x < width; i++) {
-				if (bits[7-i])
-					drawPoint(dst, baseX + x, baseY + y, color);
-				x++;
-			}
-			bufferIndex++;
-		}
-	}
-//	drawPoint(dst, offsetX, offsetY, 0x00ff0000);
-//	drawPoint(dst, offsetX, offsetY + fontHeight - 1, 0x00ff0000);
-	SDL_UnlockSurface(dst);
-}
-
-
 /*
  * ******************************************************** public
  */
@@ -388,6 +293,7 @@ void DisplaySdl2::drawBorder(const std::pair<int,int> &offset, const std::pair<i
 //void DisplaySdl2::drawText(const std::pair<int,int> &offset, const std::pair<int,int> &dimension,
 //	    const std::basic_string<char> &text) const {
 void Sdl2Out::draw(const Position &pos, const Style& stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("Sdl2Out::draw");
 //	SWFLOG(getContext(), LOG_DEBUG, "%d+%d '%s'", offset.first, offset.second, text.c_str());
 
 	SDL_Rect screenRect, fontPanelRect;
@@ -465,7 +371,7 @@ std::pair<int,int> Sdl2Out::screenDimension() const {
 }
 
 std::pair<int,int> Sdl2Out::fontDimension() const {
-	return { fontWidthAvg, fontHeight };
+	return { fontPanelCoverage.getWidthAvg(), fontPanelCoverage.getHeight() };
 }
 
 void Sdl2Out::gameLoopDrawFinish() const {
@@ -30,6 +30,8 @@
 #endif
 #include <SDL2/SDL.h>
 
+#include "FontPanel.hpp"
+
 #include "../../core/FrontendOut.hpp"
 
 
@@ -40,22 +42,15 @@ private:
 	SDL_Renderer *renderer;
 
 	// font panel, caches often used chars for blitting
-	static const int fontPanelFirstChar = 0x20;		// first char: space
-	static const int fontPanelLastChar = 0x7e;		// last char: tilde
-	static const int fontPanelCharCount = fontPanelLastChar - fontPanelFirstChar + 1;
 	struct SDL_Texture *fontPanel;
+	FontPanel fontPanelCoverage;
 	FT_Library fontLibrary;
 	FT_Face fontFace;
-	int fontPanelOffsets[fontPanelCharCount];
-	int fontHeight;
-	int fontSize;
-	int fontWidthAvg;
 	bool isFontPanelChar(const int c, SDL_Rect*) const;	// lookup char in font panel cache
 
 	// drawing
 	inline static void drawPoint(SDL_Surface*, const int, const int, const Uint32);
 	static void drawLine(SDL_Surface*, int, int, int, int, const Uint32);
-	static void drawGlyph(SDL_Surface*, const FT_GlyphSlot, const int, const int, const Uint32);
 
 public:
 	Sdl2Out(Context&, SDL_Window*, SDL_Renderer*);
@@ -24,6 +24,7 @@
 
 //#include "Component.hpp"
 #include "../../core/Context.hpp"
+#include "../../core/Profile.hpp"
 
 
 static const std::basic_string<char> LOG_FACILITY = "XCB_OUT";
@@ -102,10 +103,9 @@ xcb_gcontext_t XcbOut::getGContextInverse() const {
  * drawing
  */
 
-static xcb_rectangle_t rectBorder;
-
 /*
 void DisplayXcb::drawBorder(const std::pair<int,int> &offset, const std::pair<int,int> &dimension) const {
+	xcb_rectangle_t rectBorder;
 	rectBorder.x = offset.first;
 	rectBorder.y = offset.second;
 	rectBorder.width = dimension.first;
@@ -118,6 +118,7 @@ void DisplayXcb::drawBorder(const std::pair<int,int> &offset, const std::pair<in
 //void DisplayXcb::drawText(const std::pair<int,int> &offset, const std::pair<int,int> &dimension,
 //	    const std::basic_string<char> &text) const {
 void XcbOut::draw(const Position &pos, const Style &stl, const std::basic_string<char> &text) const {
+	SWF_ZONE("XcbOut::draw");
 	xcb_image_text_8(connection, text.size(), window, gcontext, pos.textX + 1, pos.textY + 12, text.c_str());
 //	xcb_flush(connection);
 }
@@ -196,7 +197,8 @@ xcb_window_t XcbOut::initWindow(xcb_connection_t *cn, xcb_screen_t *scr, const s
 
 	xcb_window_t win = xcb_generate_id(cn);
 	const uint32_t valueListWindow[] { scr->white_pixel,
-	    XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS };
+	    XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS |
+	    XCB_EVENT_MASK_STRUCTURE_NOTIFY };
 	xcb_create_window(cn, XCB_COPY_FROM_PARENT, win,
 	    scr->root, off.first, off.second, dim.first, dim.second, 0,
 	    XCB_WINDOW_CLASS_INPUT_OUTPUT, scr->root_visual,